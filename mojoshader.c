@@ -20,16 +20,6 @@
 
 // Deal with register lists...  !!! FIXME: I sort of hate this.
 
-static void free_reglist(MOJOSHADER_free f, void *d, RegisterList *item)
-{
-    while (item != NULL)
-    {
-        RegisterList *next = item->next;
-        f(item, d);
-        item = next;
-    } // while
-} // free_reglist
-
 static inline const RegisterList *reglist_exists(RegisterList *prev,
                                                  const RegisterType regtype,
                                                  const int regnum)
@@ -537,7 +527,7 @@ static void determine_constants_arrays(Context *ctx)
             if (count > 0)  // multiple constants in the set?
             {
                 VariableList *var;
-                var = (VariableList *) Malloc(ctx, sizeof (VariableList));
+                var = (VariableList *) ScratchMalloc(ctx, sizeof (VariableList));
                 if (var == NULL)
                     break;
 
@@ -1232,7 +1222,7 @@ static int parse_args_TEXLD(Context *ctx)
 
 static ConstantsList *alloc_constant_listitem(Context *ctx)
 {
-    ConstantsList *item = (ConstantsList *) Malloc(ctx, sizeof (ConstantsList));
+    ConstantsList *item = (ConstantsList *) ScratchMalloc(ctx, sizeof (ConstantsList));
     if (item == NULL)
         return NULL;
 
@@ -2369,7 +2359,7 @@ static void parse_constant_table(Context *ctx, const uint32 *tokens,
         if ((setvariables) && (mojotype != MOJOSHADER_UNIFORM_UNKNOWN))
         {
             VariableList *item;
-            item = (VariableList *) Malloc(ctx, sizeof (VariableList));
+            item = (VariableList *) ScratchMalloc(ctx, sizeof (VariableList));
             if (item != NULL)
             {
                 item->type = mojotype;
@@ -2952,6 +2942,7 @@ static Context *build_context(const char *profile,
     ctx->malloc = m;
     ctx->free = f;
     ctx->malloc_data = d;
+    arena_init(&ctx->scratch, 16 * 1024, m, f, d);
     ctx->tokens = (const uint32 *) tokenbuf;
     ctx->orig_tokens = (const uint32 *) tokenbuf;
     ctx->know_shader_size = (bufsize != 0);
@@ -2981,6 +2972,7 @@ static Context *build_context(const char *profile,
     if (!set_output(ctx, &ctx->mainline))
     {
         errorlist_destroy(ctx->errors);
+        arena_destroy(&ctx->scratch);
         f(ctx, d);
         return NULL;
     } // if
@@ -3007,28 +2999,6 @@ static Context *build_context(const char *profile,
 } // build_context
 
 
-static void free_constants_list(MOJOSHADER_free f, void *d, ConstantsList *item)
-{
-    while (item != NULL)
-    {
-        ConstantsList *next = item->next;
-        f(item, d);
-        item = next;
-    } // while
-} // free_constants_list
-
-
-static void free_variable_list(MOJOSHADER_free f, void *d, VariableList *item)
-{
-    while (item != NULL)
-    {
-        VariableList *next = item->next;
-        f(item, d);
-        item = next;
-    } // while
-} // free_variable_list
-
-
 static void free_sym_typeinfo(MOJOSHADER_free f, void *d,
                               MOJOSHADER_symbolTypeInfo *typeinfo)
 {
@@ -3061,25 +3031,15 @@ static void destroy_context(Context *ctx)
     {
         MOJOSHADER_free f = ((ctx->free != NULL) ? ctx->free : MOJOSHADER_internal_free);
         void *d = ctx->malloc_data;
-        buffer_destroy(ctx->preflight);
-        buffer_destroy(ctx->globals);
-        buffer_destroy(ctx->inputs);
-        buffer_destroy(ctx->outputs);
-        buffer_destroy(ctx->helpers);
-        buffer_destroy(ctx->subroutines);
-        buffer_destroy(ctx->mainline_intro);
-        buffer_destroy(ctx->mainline_arguments);
-        buffer_destroy(ctx->mainline_top);
-        buffer_destroy(ctx->mainline);
-        buffer_destroy(ctx->postflight);
-        buffer_destroy(ctx->ignore);
-        free_constants_list(f, d, ctx->constants);
-        free_reglist(f, d, ctx->used_registers.next);
-        free_reglist(f, d, ctx->defined_registers.next);
-        free_reglist(f, d, ctx->uniforms.next);
-        free_reglist(f, d, ctx->attributes.next);
-        free_reglist(f, d, ctx->samplers.next);
-        free_variable_list(f, d, ctx->variables);
+
+#if MOJOSHADER_DEBUG_MALLOC
+        printf("scratch arena: %u allocations in %u blocks\n",
+               (uint) ctx->scratch.allocations, (uint) ctx->scratch.blocks);
+#endif
+
+        // The output sections, register lists, constants and variables all
+        //  live in the scratch arena, so this frees them in one shot.
+        arena_destroy(&ctx->scratch);
         errorlist_destroy(ctx->errors);
         free_symbols(f, d, ctx->ctab.symbols, ctx->ctab.symbol_count);
         MOJOSHADER_freePreshader(ctx->preshader);
@@ -3098,7 +3058,8 @@ static char *build_output(Context *ctx, size_t *len)
         ctx->mainline_top, ctx->mainline, ctx->postflight
         // don't append ctx->ignore ... that's why it's called "ignore"
     };
-    char *retval = buffer_merge(buffers, STATICARRAYLEN(buffers), len);
+    char *retval = buffer_merge(buffers, STATICARRAYLEN(buffers), len,
+                                MallocBridge, ctx);
     return retval;
 } // build_output
 
@@ -3622,9 +3583,8 @@ static void process_definitions(Context *ctx)
                 case REG_TYPE_CONSTINT:
                 case REG_TYPE_CONSTBOOL:
                     // separate uniforms into a different list for now.
-                    prev->next = next;
-                    item->next = NULL;
-                    uitem->next = item;
+                    reglist_unlink(&ctx->used_registers, prev, item);
+                    reglist_append(ctx, &ctx->uniforms, uitem, item);
                     uitem = item;
                     item = prev;
                     break;
@@ -4002,6 +3962,1078 @@ void MOJOSHADER_freePreshader(const MOJOSHADER_preshader *preshader)
     } // if
 } // MOJOSHADER_freePreshader
 
+
+// Translation cache...
+
+// Bump this whenever the serialized layout changes. Old cache files are
+//  rejected by MOJOSHADER_deserializeParseData() and silently rebuilt.
+#define PARSECACHE_MAGIC 0x4450534D  // 0x4450534D == 'MSPD'
+#define PARSECACHE_FORMAT_VERSION 2
+#define PARSECACHE_NULLSTR 0xFFFFFFFF
+
+typedef struct ParseCacheWriter
+{
+    Buffer *buffer;
+    int failed;
+} ParseCacheWriter;
+
+static void pcache_write(ParseCacheWriter *w, const void *data, const size_t len)
+{
+    if ((!w->failed) && (!buffer_append(w->buffer, data, len)))
+        w->failed = 1;
+} // pcache_write
+
+static void pcache_write_ui32(ParseCacheWriter *w, const uint32 val)
+{
+    pcache_write(w, &val, sizeof (val));
+} // pcache_write_ui32
+
+static void pcache_write_int(ParseCacheWriter *w, const int val)
+{
+    pcache_write_ui32(w, (uint32) val);
+} // pcache_write_int
+
+static void pcache_write_string(ParseCacheWriter *w, const char *str)
+{
+    if (str == NULL)
+        pcache_write_ui32(w, PARSECACHE_NULLSTR);
+    else
+    {
+        const uint32 len = (uint32) strlen(str);
+        pcache_write_ui32(w, len);
+        pcache_write(w, str, len);
+    } // else
+} // pcache_write_string
+
+static void pcache_write_typeinfo(ParseCacheWriter *w,
+                                  const MOJOSHADER_symbolTypeInfo *info)
+{
+    unsigned int i;
+    pcache_write_int(w, (int) info->parameter_class);
+    pcache_write_int(w, (int) info->parameter_type);
+    pcache_write_ui32(w, info->rows);
+    pcache_write_ui32(w, info->columns);
+    pcache_write_ui32(w, info->elements);
+    pcache_write_ui32(w, info->member_count);
+    for (i = 0; i < info->member_count; i++)
+    {
+        pcache_write_string(w, info->members[i].name);
+        pcache_write_typeinfo(w, &info->members[i].info);
+    } // for
+} // pcache_write_typeinfo
+
+static void pcache_write_symbols(ParseCacheWriter *w,
+                                 const MOJOSHADER_symbol *syms,
+                                 const unsigned int count)
+{
+    unsigned int i;
+    pcache_write_ui32(w, count);
+    for (i = 0; i < count; i++)
+    {
+        pcache_write_string(w, syms[i].name);
+        pcache_write_int(w, (int) syms[i].register_set);
+        pcache_write_ui32(w, syms[i].register_index);
+        pcache_write_ui32(w, syms[i].register_count);
+        pcache_write_typeinfo(w, &syms[i].info);
+    } // for
+} // pcache_write_symbols
+
+static void pcache_write_preshader(ParseCacheWriter *w,
+                                   const MOJOSHADER_preshader *preshader)
+{
+    unsigned int i, j;
+
+    pcache_write_ui32(w, (preshader != NULL) ? 1 : 0);
+    if (preshader == NULL)
+        return;
+
+    pcache_write_ui32(w, preshader->literal_count);
+    pcache_write(w, preshader->literals,
+                 sizeof (double) * preshader->literal_count);
+    pcache_write_ui32(w, preshader->temp_count);
+    pcache_write_symbols(w, preshader->symbols, preshader->symbol_count);
+    pcache_write_ui32(w, preshader->instruction_count);
+    for (i = 0; i < preshader->instruction_count; i++)
+    {
+        const MOJOSHADER_preshaderInstruction *inst = &preshader->instructions[i];
+        pcache_write_int(w, (int) inst->opcode);
+        pcache_write_ui32(w, inst->element_count);
+        pcache_write_ui32(w, inst->operand_count);
+        for (j = 0; j < inst->operand_count; j++)
+        {
+            const MOJOSHADER_preshaderOperand *operand = &inst->operands[j];
+            pcache_write_int(w, (int) operand->type);
+            pcache_write_ui32(w, operand->index);
+            pcache_write_ui32(w, operand->array_register_count);
+            pcache_write(w, operand->array_registers,
+                         sizeof (unsigned int) * operand->array_register_count);
+        } // for
+    } // for
+} // pcache_write_preshader
+
+static void pcache_write_attributes(ParseCacheWriter *w,
+                                    const MOJOSHADER_attribute *attrs,
+                                    const int count)
+{
+    int i;
+    pcache_write_int(w, count);
+    for (i = 0; i < count; i++)
+    {
+        pcache_write_int(w, (int) attrs[i].usage);
+        pcache_write_int(w, attrs[i].index);
+        pcache_write_string(w, attrs[i].name);
+    } // for
+} // pcache_write_attributes
+
+#if SUPPORT_PROFILE_SPIRV
+// Both SPIR-V profiles append a patch table to the output.
+static int pcache_has_spirv_table(const char *profile)
+{
+    return ( (strcmp(profile, MOJOSHADER_PROFILE_SPIRV) == 0) ||
+             (strcmp(profile, MOJOSHADER_PROFILE_GLSPIRV) == 0) );
+} // pcache_has_spirv_table
+
+// The SPIR-V patch table at the end of the output has pointers to separate
+//  allocations for the attribute load fixups. Store the table with those
+//  pointers cleared, so the blob is the same no matter where they were,
+//  and then store the lists themselves.
+static void pcache_write_spirv_output(ParseCacheWriter *w,
+                                      const MOJOSHADER_parseData *data)
+{
+    const int binary_size = data->output_len - (int) sizeof (SpirvPatchTable);
+    SpirvPatchTable table;
+    size_t i, j;
+
+    if (binary_size < 0)
+    {
+        w->failed = 1;
+        return;
+    } // if
+
+    memcpy(&table, &data->output[binary_size], sizeof (table));
+    for (i = 0; i < STATICARRAYLEN(table.attrib_type_load_offsets); i++)
+    {
+        for (j = 0; j < STATICARRAYLEN(table.attrib_type_load_offsets[i]); j++)
+        {
+            table.attrib_type_load_offsets[i][j].load_types = NULL;
+            table.attrib_type_load_offsets[i][j].load_opcodes = NULL;
+        } // for
+    } // for
+
+    pcache_write(w, data->output, binary_size);
+    pcache_write(w, &table, sizeof (table));
+    pcache_write(w, &data->output[data->output_len], 1);  // null terminator.
+
+    memcpy(&table, &data->output[binary_size], sizeof (table));
+    for (i = 0; i < STATICARRAYLEN(table.attrib_type_load_offsets); i++)
+    {
+        for (j = 0; j < STATICARRAYLEN(table.attrib_type_load_offsets[i]); j++)
+        {
+            const uint32 num_loads = table.attrib_type_load_offsets[i][j].num_loads;
+            pcache_write_ui32(w, num_loads);
+            pcache_write(w, table.attrib_type_load_offsets[i][j].load_types,
+                         sizeof (uint32) * num_loads);
+            pcache_write(w, table.attrib_type_load_offsets[i][j].load_opcodes,
+                         sizeof (uint32) * num_loads);
+        } // for
+    } // for
+} // pcache_write_spirv_output
+#endif
+
+void *MOJOSHADER_serializeParseData(const MOJOSHADER_parseData *data,
+                                    unsigned int *len,
+                                    MOJOSHADER_malloc m,
+                                    MOJOSHADER_free f,
+                                    void *d)
+{
+    ParseCacheWriter w;
+    void *retval = NULL;
+    size_t total = 0;
+    int i;
+
+    *len = 0;
+    if ( ((m == NULL) && (f != NULL)) || ((m != NULL) && (f == NULL)) )
+        return NULL;  // supply both or neither.
+    else if ((data == NULL) || (data->error_count > 0) || (data->output == NULL))
+        return NULL;  // only successful translations are worth keeping.
+
+    if (m == NULL) m = MOJOSHADER_internal_malloc;
+    if (f == NULL) f = MOJOSHADER_internal_free;
+
+    w.failed = 0;
+    w.buffer = buffer_create(4096, m, f, d);
+    if (w.buffer == NULL)
+        return NULL;
+
+    pcache_write_ui32(&w, PARSECACHE_MAGIC);
+    pcache_write_ui32(&w, PARSECACHE_FORMAT_VERSION);
+    pcache_write_string(&w, data->profile);
+    pcache_write_string(&w, data->mainfn);
+    pcache_write_ui32(&w, (uint32) data->output_len);
+#if SUPPORT_PROFILE_SPIRV
+    if (pcache_has_spirv_table(data->profile))
+        pcache_write_spirv_output(&w, data);
+    else
+#endif
+    // include the null terminator, since most profiles output strings.
+    pcache_write(&w, data->output, data->output_len + 1);
+    pcache_write_int(&w, data->instruction_count);
+    pcache_write_int(&w, (int) data->shader_type);
+    pcache_write_int(&w, data->major_ver);
+    pcache_write_int(&w, data->minor_ver);
+
+    pcache_write_int(&w, data->uniform_count);
+    for (i = 0; i < data->uniform_count; i++)
+    {
+        const MOJOSHADER_uniform *u = &data->uniforms[i];
+        pcache_write_int(&w, (int) u->type);
+        pcache_write_int(&w, u->index);
+        pcache_write_int(&w, u->array_count);
+        pcache_write_int(&w, u->constant);
+        pcache_write_string(&w, u->name);
+    } // for
+
+    pcache_write_int(&w, data->constant_count);
+    for (i = 0; i < data->constant_count; i++)
+    {
+        const MOJOSHADER_constant *c = &data->constants[i];
+        pcache_write_int(&w, (int) c->type);
+        pcache_write_int(&w, c->index);
+        pcache_write(&w, &c->value, sizeof (c->value));
+    } // for
+
+    pcache_write_int(&w, data->sampler_count);
+    for (i = 0; i < data->sampler_count; i++)
+    {
+        const MOJOSHADER_sampler *s = &data->samplers[i];
+        pcache_write_int(&w, (int) s->type);
+        pcache_write_int(&w, s->index);
+        pcache_write_string(&w, s->name);
+        pcache_write_int(&w, s->texbem);
+    } // for
+
+    pcache_write_attributes(&w, data->attributes, data->attribute_count);
+    pcache_write_attributes(&w, data->outputs, data->output_count);
+
+    pcache_write_int(&w, data->swizzle_count);
+    pcache_write(&w, data->swizzles,
+                 sizeof (MOJOSHADER_swizzle) * data->swizzle_count);
+
+    pcache_write_symbols(&w, data->symbols, (unsigned int) data->symbol_count);
+    pcache_write_preshader(&w, data->preshader);
+
+    if (!w.failed)
+    {
+        total = buffer_size(w.buffer);
+        retval = buffer_flatten(w.buffer);
+        if (retval != NULL)
+            *len = (unsigned int) total;
+    } // if
+
+    buffer_destroy(w.buffer);
+    return retval;
+} // MOJOSHADER_serializeParseData
+
+
+typedef struct ParseCacheReader
+{
+    const uint8 *ptr;
+    size_t remain;
+    int failed;
+    MOJOSHADER_malloc m;
+    MOJOSHADER_free f;
+    void *d;
+} ParseCacheReader;
+
+static const void *pcache_read(ParseCacheReader *r, const size_t len)
+{
+    const void *retval = r->ptr;
+    if (r->failed)
+        return NULL;
+    else if (len > r->remain)
+    {
+        r->failed = 1;
+        return NULL;
+    } // else if
+
+    r->ptr += len;
+    r->remain -= len;
+    return retval;
+} // pcache_read
+
+static uint32 pcache_read_ui32(ParseCacheReader *r)
+{
+    uint32 retval = 0;
+    const void *ptr = pcache_read(r, sizeof (retval));
+    if (ptr != NULL)
+        memcpy(&retval, ptr, sizeof (retval));
+    return retval;
+} // pcache_read_ui32
+
+static int pcache_read_int(ParseCacheReader *r)
+{
+    return (int) pcache_read_ui32(r);
+} // pcache_read_int
+
+// Reads (count) items of (size) bytes into a freshly allocated array. Counts
+//  are checked against the remaining data first, so a corrupt file can't
+//  make us allocate something enormous.
+static void *pcache_read_array(ParseCacheReader *r, const uint32 count,
+                               const size_t size, const size_t minsize)
+{
+    void *retval = NULL;
+    if ((r->failed) || (count == 0))
+        return NULL;
+    else if ((count > (r->remain / minsize)) || (count > (0x7FFFFFFF / size)))
+    {
+        r->failed = 1;
+        return NULL;
+    } // else if
+
+    retval = r->m((int) (count * size), r->d);
+    if (retval == NULL)
+        r->failed = 1;
+    else
+        memset(retval, '\0', count * size);
+    return retval;
+} // pcache_read_array
+
+static void *pcache_read_copy(ParseCacheReader *r, const uint32 count,
+                              const size_t size)
+{
+    void *retval = pcache_read_array(r, count, size, size);
+    const void *src = (retval != NULL) ? pcache_read(r, count * size) : NULL;
+    if (src != NULL)
+        memcpy(retval, src, count * size);
+    return retval;
+} // pcache_read_copy
+
+static char *pcache_read_string(ParseCacheReader *r)
+{
+    const uint32 len = pcache_read_ui32(r);
+    const char *src = NULL;
+    char *retval = NULL;
+
+    if ((r->failed) || (len == PARSECACHE_NULLSTR))
+        return NULL;
+    else if ((src = (const char *) pcache_read(r, len)) == NULL)
+        return NULL;
+    else if ((retval = (char *) r->m((int) len + 1, r->d)) == NULL)
+    {
+        r->failed = 1;
+        return NULL;
+    } // else if
+
+    memcpy(retval, src, len);
+    retval[len] = '\0';
+    return retval;
+} // pcache_read_string
+
+static void pcache_read_typeinfo(ParseCacheReader *r,
+                                 MOJOSHADER_symbolTypeInfo *info)
+{
+    unsigned int i;
+    uint32 count;
+
+    info->parameter_class = (MOJOSHADER_symbolClass) pcache_read_int(r);
+    info->parameter_type = (MOJOSHADER_symbolType) pcache_read_int(r);
+    info->rows = pcache_read_ui32(r);
+    info->columns = pcache_read_ui32(r);
+    info->elements = pcache_read_ui32(r);
+    count = pcache_read_ui32(r);
+    info->members = (MOJOSHADER_symbolStructMember *)
+        pcache_read_array(r, count, sizeof (MOJOSHADER_symbolStructMember), 28);
+    if (info->members == NULL)
+        return;
+
+    info->member_count = count;
+    for (i = 0; (i < count) && (!r->failed); i++)
+    {
+        info->members[i].name = pcache_read_string(r);
+        pcache_read_typeinfo(r, &info->members[i].info);
+    } // for
+} // pcache_read_typeinfo
+
+static MOJOSHADER_symbol *pcache_read_symbols(ParseCacheReader *r,
+                                              unsigned int *_count)
+{
+    const uint32 count = pcache_read_ui32(r);
+    MOJOSHADER_symbol *retval = (MOJOSHADER_symbol *)
+        pcache_read_array(r, count, sizeof (MOJOSHADER_symbol), 40);
+    unsigned int i;
+
+    *_count = 0;
+    if (retval == NULL)
+        return NULL;
+
+    *_count = count;
+    for (i = 0; (i < count) && (!r->failed); i++)
+    {
+        retval[i].name = pcache_read_string(r);
+        retval[i].register_set = (MOJOSHADER_symbolRegisterSet) pcache_read_int(r);
+        retval[i].register_index = pcache_read_ui32(r);
+        retval[i].register_count = pcache_read_ui32(r);
+        pcache_read_typeinfo(r, &retval[i].info);
+    } // for
+
+    return retval;
+} // pcache_read_symbols
+
+static MOJOSHADER_preshader *pcache_read_preshader(ParseCacheReader *r)
+{
+    MOJOSHADER_preshader *retval = NULL;
+    unsigned int i, j;
+    uint32 count;
+
+    if (pcache_read_ui32(r) == 0)
+        return NULL;  // no preshader (or r->failed, which is also fine).
+
+    retval = (MOJOSHADER_preshader *) pcache_read_array(r, 1,
+                                            sizeof (MOJOSHADER_preshader), 1);
+    if (retval == NULL)
+        return NULL;
+
+    retval->malloc = (r->m == MOJOSHADER_internal_malloc) ? NULL : r->m;
+    retval->free = (r->f == MOJOSHADER_internal_free) ? NULL : r->f;
+    retval->malloc_data = r->d;
+
+    count = pcache_read_ui32(r);
+    retval->literals = (double *) pcache_read_copy(r, count, sizeof (double));
+    if (retval->literals != NULL)
+        retval->literal_count = count;
+    retval->temp_count = pcache_read_ui32(r);
+    retval->symbols = pcache_read_symbols(r, &retval->symbol_count);
+
+    count = pcache_read_ui32(r);
+    retval->instructions = (MOJOSHADER_preshaderInstruction *)
+        pcache_read_array(r, count, sizeof (MOJOSHADER_preshaderInstruction), 12);
+    if (retval->instructions != NULL)
+        retval->instruction_count = count;
+
+    for (i = 0; (i < retval->instruction_count) && (!r->failed); i++)
+    {
+        MOJOSHADER_preshaderInstruction *inst = &retval->instructions[i];
+        inst->opcode = (MOJOSHADER_preshaderOpcode) pcache_read_int(r);
+        inst->element_count = pcache_read_ui32(r);
+        count = pcache_read_ui32(r);
+        if (count > STATICARRAYLEN(inst->operands))
+        {
+            r->failed = 1;
+            break;
+        } // if
+
+        inst->operand_count = count;
+        for (j = 0; j < count; j++)
+        {
+            MOJOSHADER_preshaderOperand *operand = &inst->operands[j];
+            operand->type = (MOJOSHADER_preshaderOperandType) pcache_read_int(r);
+            operand->index = pcache_read_ui32(r);
+            operand->array_register_count = pcache_read_ui32(r);
+            operand->array_registers = (unsigned int *) pcache_read_copy(r,
+                    operand->array_register_count, sizeof (unsigned int));
+            if (operand->array_registers == NULL)
+                operand->array_register_count = 0;
+        } // for
+    } // for
+
+    // The register file is scratch space for MOJOSHADER_runPreshader(), so
+    //  we size it from the symbols, like parse_preshader() does, instead of
+    //  storing it.
+    count = 0;
+    for (i = 0; (i < retval->symbol_count) && (!r->failed); i++)
+    {
+        const MOJOSHADER_symbol *sym = &retval->symbols[i];
+        if ((sym->register_index + sym->register_count) > count)
+            count = sym->register_index + sym->register_count;
+    } // for
+
+    if ((count > 0) && (!r->failed))
+    {
+        const size_t len = count * sizeof (float) * 4;
+        retval->registers = (float *) r->m((int) len, r->d);
+        if (retval->registers == NULL)
+            r->failed = 1;
+        else
+        {
+            memset(retval->registers, '\0', len);
+            retval->register_count = count;
+        } // else
+    } // if
+
+    return retval;
+} // pcache_read_preshader
+
+#if SUPPORT_PROFILE_SPIRV
+static void pcache_read_spirv_loads(ParseCacheReader *r,
+                                    const MOJOSHADER_parseData *data)
+{
+    const int binary_size = data->output_len - (int) sizeof (SpirvPatchTable);
+    SpirvPatchTable *table = (SpirvPatchTable *) &data->output[binary_size];
+    size_t i, j;
+
+    if (binary_size < 0)
+    {
+        r->failed = 1;
+        return;
+    } // if
+
+    // Clear these first, so we never leave stale pointers from the original
+    //  process lying around if we fail partway through.
+    for (i = 0; i < STATICARRAYLEN(table->attrib_type_load_offsets); i++)
+    {
+        for (j = 0; j < STATICARRAYLEN(table->attrib_type_load_offsets[i]); j++)
+        {
+            table->attrib_type_load_offsets[i][j].num_loads = 0;
+            table->attrib_type_load_offsets[i][j].load_types = NULL;
+            table->attrib_type_load_offsets[i][j].load_opcodes = NULL;
+        } // for
+    } // for
+
+    for (i = 0; i < STATICARRAYLEN(table->attrib_type_load_offsets); i++)
+    {
+        for (j = 0; j < STATICARRAYLEN(table->attrib_type_load_offsets[i]); j++)
+        {
+            const uint32 num_loads = pcache_read_ui32(r);
+            uint32 *types = (uint32 *) pcache_read_copy(r, num_loads, sizeof (uint32));
+            uint32 *opcodes = (uint32 *) pcache_read_copy(r, num_loads, sizeof (uint32));
+            if (r->failed)
+            {
+                r->f(types, r->d);
+                r->f(opcodes, r->d);
+                return;
+            } // if
+
+            table->attrib_type_load_offsets[i][j].num_loads = num_loads;
+            table->attrib_type_load_offsets[i][j].load_types = types;
+            table->attrib_type_load_offsets[i][j].load_opcodes = opcodes;
+        } // for
+    } // for
+} // pcache_read_spirv_loads
+#endif
+
+static MOJOSHADER_attribute *pcache_read_attributes(ParseCacheReader *r,
+                                                    int *_count)
+{
+    const int count = pcache_read_int(r);
+    MOJOSHADER_attribute *retval = (MOJOSHADER_attribute *)
+        pcache_read_array(r, count, sizeof (MOJOSHADER_attribute), 12);
+    int i;
+
+    *_count = 0;
+    if (retval == NULL)
+        return NULL;
+
+    *_count = count;
+    for (i = 0; (i < count) && (!r->failed); i++)
+    {
+        retval[i].usage = (MOJOSHADER_usage) pcache_read_int(r);
+        retval[i].index = pcache_read_int(r);
+        retval[i].name = pcache_read_string(r);
+    } // for
+
+    return retval;
+} // pcache_read_attributes
+
+const MOJOSHADER_parseData *MOJOSHADER_deserializeParseData(const void *buf,
+                                                            const unsigned int len,
+                                                            MOJOSHADER_malloc m,
+                                                            MOJOSHADER_free f,
+                                                            void *d)
+{
+    MOJOSHADER_parseData *retval = NULL;
+    ParseCacheReader r;
+    char *profile = NULL;
+    const char *output = NULL;
+    uint32 count;
+    int profileid;
+    int i;
+
+    if ( ((m == NULL) && (f != NULL)) || ((m != NULL) && (f == NULL)) )
+        return NULL;  // supply both or neither.
+
+    if (m == NULL) m = MOJOSHADER_internal_malloc;
+    if (f == NULL) f = MOJOSHADER_internal_free;
+
+    r.ptr = (const uint8 *) buf;
+    r.remain = (buf != NULL) ? len : 0;
+    r.failed = 0;
+    r.m = m;
+    r.f = f;
+    r.d = d;
+
+    if (pcache_read_ui32(&r) != PARSECACHE_MAGIC)
+        return NULL;
+    else if (pcache_read_ui32(&r) != PARSECACHE_FORMAT_VERSION)
+        return NULL;
+
+    // profile names point to static strings, so map it back to ours.
+    profile = pcache_read_string(&r);
+    profileid = (profile != NULL) ? find_profile_id(profile) : -1;
+    f(profile, d);
+    if (profileid < 0)
+        return NULL;
+
+    retval = (MOJOSHADER_parseData *) m(sizeof (MOJOSHADER_parseData), d);
+    if (retval == NULL)
+        return NULL;
+
+    memset(retval, '\0', sizeof (MOJOSHADER_parseData));
+    retval->profile = profiles[profileid].name;
+    retval->malloc = (m == MOJOSHADER_internal_malloc) ? NULL : m;
+    retval->free = (f == MOJOSHADER_internal_free) ? NULL : f;
+    retval->malloc_data = d;
+
+    retval->mainfn = pcache_read_string(&r);
+    count = pcache_read_ui32(&r);
+    if (count < 0x7FFFFFFF)
+    {
+        output = (const char *) pcache_read_copy(&r, count + 1, 1);
+        if (output != NULL)
+        {
+            retval->output = output;
+            retval->output_len = (int) count;
+        } // if
+    } // if
+    if (output == NULL)
+        r.failed = 1;
+#if SUPPORT_PROFILE_SPIRV
+    else if (pcache_has_spirv_table(retval->profile))
+        pcache_read_spirv_loads(&r, retval);
+#endif
+
+    retval->instruction_count = pcache_read_int(&r);
+    retval->shader_type = (MOJOSHADER_shaderType) pcache_read_int(&r);
+    retval->major_ver = pcache_read_int(&r);
+    retval->minor_ver = pcache_read_int(&r);
+
+    count = pcache_read_ui32(&r);
+    retval->uniforms = (MOJOSHADER_uniform *) pcache_read_array(&r, count,
+                                                sizeof (MOJOSHADER_uniform), 20);
+    if (retval->uniforms != NULL)
+        retval->uniform_count = (int) count;
+    for (i = 0; (i < retval->uniform_count) && (!r.failed); i++)
+    {
+        MOJOSHADER_uniform *u = &retval->uniforms[i];
+        u->type = (MOJOSHADER_uniformType) pcache_read_int(&r);
+        u->index = pcache_read_int(&r);
+        u->array_count = pcache_read_int(&r);
+        u->constant = pcache_read_int(&r);
+        u->name = pcache_read_string(&r);
+    } // for
+
+    count = pcache_read_ui32(&r);
+    retval->constants = (MOJOSHADER_constant *) pcache_read_array(&r, count,
+                                                sizeof (MOJOSHADER_constant), 24);
+    if (retval->constants != NULL)
+        retval->constant_count = (int) count;
+    for (i = 0; (i < retval->constant_count) && (!r.failed); i++)
+    {
+        MOJOSHADER_constant *c = &retval->constants[i];
+        const void *value;
+        c->type = (MOJOSHADER_uniformType) pcache_read_int(&r);
+        c->index = pcache_read_int(&r);
+        value = pcache_read(&r, sizeof (c->value));
+        if (value != NULL)
+            memcpy(&c->value, value, sizeof (c->value));
+    } // for
+
+    count = pcache_read_ui32(&r);
+    retval->samplers = (MOJOSHADER_sampler *) pcache_read_array(&r, count,
+                                                sizeof (MOJOSHADER_sampler), 16);
+    if (retval->samplers != NULL)
+        retval->sampler_count = (int) count;
+    for (i = 0; (i < retval->sampler_count) && (!r.failed); i++)
+    {
+        MOJOSHADER_sampler *s = &retval->samplers[i];
+        s->type = (MOJOSHADER_samplerType) pcache_read_int(&r);
+        s->index = pcache_read_int(&r);
+        s->name = pcache_read_string(&r);
+        s->texbem = pcache_read_int(&r);
+    } // for
+
+    retval->attributes = pcache_read_attributes(&r, &retval->attribute_count);
+    retval->outputs = pcache_read_attributes(&r, &retval->output_count);
+
+    count = pcache_read_ui32(&r);
+    retval->swizzles = (MOJOSHADER_swizzle *) pcache_read_copy(&r, count,
+                                                    sizeof (MOJOSHADER_swizzle));
+    if (retval->swizzles != NULL)
+        retval->swizzle_count = (int) count;
+
+    retval->symbols = pcache_read_symbols(&r, &count);
+    retval->symbol_count = (int) count;
+    retval->preshader = pcache_read_preshader(&r);
+
+    if ((r.failed) || (r.remain != 0))
+    {
+        MOJOSHADER_freeParseData(retval);
+        return NULL;
+    } // if
+
+    return retval;
+} // MOJOSHADER_deserializeParseData
+
+
+// this is 64-bit FNV-1a; we don't need cryptographic strength here, just
+//  something fast with few collisions between different shaders.
+static uint64 pcache_hash(uint64 hash, const void *_data, size_t len)
+{
+    const uint8 *data = (const uint8 *) _data;
+    while (len--)
+    {
+        hash ^= (uint64) *(data++);
+        hash *= 0x100000001B3ULL;
+    } // while
+    return hash;
+} // pcache_hash
+
+static uint64 pcache_hash_string(uint64 hash, const char *str)
+{
+    // hash the null terminator too, so "ab"+"c" != "a"+"bc".
+    return (str == NULL) ? pcache_hash(hash, "", 1) :
+                           pcache_hash(hash, str, strlen(str) + 1);
+} // pcache_hash_string
+
+#ifndef MOJOSHADER_USE_SDL_STDLIB
+
+// Build options that change what the translators emit for the same input.
+//  MOJOSHADER_CHANGESET doesn't cover these (and is "???" outside a git
+//  checkout), so they go into every cache key too. Bump
+//  PARSECACHE_TRANSLATOR_VERSION by hand whenever a profile's output
+//  changes, so caches written by older builds are never picked up.
+#define PARSECACHE_TRANSLATOR_VERSION 1
+static const uint32 pcache_buildconfig[] =
+{
+    PARSECACHE_TRANSLATOR_VERSION,
+    PARSECACHE_FORMAT_VERSION,
+    MOJOSHADER_BIG_ENDIAN,  // cache files are written in native byte order.
+#ifdef MOJOSHADER_FLIP_RENDERTARGET
+    1,
+#else
+    0,
+#endif
+#ifdef MOJOSHADER_DEPTH_CLIPPING
+    1,
+#else
+    0,
+#endif
+#ifdef MOJOSHADER_XNA4_VERTEX_TEXTURES
+    1,
+#else
+    0,
+#endif
+#ifdef MOJOSHADER_GLSL_UNIFORM_BUFFERS
+    1,
+#else
+    0,
+#endif
+    // the SPIR-V patch table is stored as-is, pointers and all.
+    (uint32) sizeof (void *),
+#if SUPPORT_PROFILE_SPIRV
+    (uint32) sizeof (SpirvPatchTable),
+#else
+    0,
+#endif
+};
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN 1
+#include <windows.h>
+#else
+#include <unistd.h>
+#endif
+
+static char *pcache_filename(const char *cachedir, const uint64 key,
+                             const char *ext, MOJOSHADER_malloc m, void *d)
+{
+    const size_t len = strlen(cachedir) + 32;
+    char *retval = (char *) m((int) len, d);
+    if (retval != NULL)
+    {
+        snprintf(retval, len, "%s/%08X%08X.%s", cachedir,
+                 (uint) ((key >> 32) & 0xFFFFFFFF), (uint) (key & 0xFFFFFFFF),
+                 ext);
+    } // if
+    return retval;
+} // pcache_filename
+
+// Every writer gets its own temp file, so two processes (or threads)
+//  storing the same key never write into each other's file.
+static char *pcache_tmpfilename(const char *cachedir, const uint64 key,
+                                MOJOSHADER_malloc m, void *d)
+{
+    static volatile int counter = 0;
+    const int serial = atomic_add(&counter, 1);
+#ifdef _WIN32
+    const unsigned long pid = (unsigned long) GetCurrentProcessId();
+#else
+    const unsigned long pid = (unsigned long) getpid();
+#endif
+    const size_t len = strlen(cachedir) + 64;
+    char *retval = (char *) m((int) len, d);
+    if (retval != NULL)
+    {
+        snprintf(retval, len, "%s/%08X%08X.%lu-%d.tmp", cachedir,
+                 (uint) ((key >> 32) & 0xFFFFFFFF), (uint) (key & 0xFFFFFFFF),
+                 pid, serial);
+    } // if
+    return retval;
+} // pcache_tmpfilename
+
+static int pcache_rename(const char *from, const char *to)
+{
+#ifdef _WIN32
+    // rename() fails on Windows if (to) exists, which it will whenever
+    //  another writer beat us to this key. Same narrow paths as fopen().
+    return MoveFileExA(from, to, MOVEFILE_REPLACE_EXISTING) ? 0 : -1;
+#else
+    return rename(from, to);
+#endif
+} // pcache_rename
+
+static const MOJOSHADER_parseData *pcache_load(const char *fname,
+                                               MOJOSHADER_malloc m,
+                                               MOJOSHADER_free f, void *d)
+{
+    const MOJOSHADER_parseData *retval = NULL;
+    FILE *io = fopen(fname, "rb");
+    void *buf = NULL;
+    long len = 0;
+
+    if (io == NULL)
+        return NULL;  // not cached yet.
+
+    if ((fseek(io, 0, SEEK_END) == 0) && ((len = ftell(io)) > 0) &&
+        (len < 0x7FFFFFFF) && (fseek(io, 0, SEEK_SET) == 0))
+    {
+        buf = m((int) len, d);
+        if ((buf != NULL) && (fread(buf, (size_t) len, 1, io) == 1))
+            retval = MOJOSHADER_deserializeParseData(buf, (unsigned int) len, m, f, d);
+        f(buf, d);
+    } // if
+
+    fclose(io);
+    return retval;
+} // pcache_load
+
+static void pcache_store(const char *cachedir, const uint64 key,
+                         const char *fname, const MOJOSHADER_parseData *pd,
+                         MOJOSHADER_malloc m, MOJOSHADER_free f, void *d)
+{
+    unsigned int len = 0;
+    void *buf = MOJOSHADER_serializeParseData(pd, &len, m, f, d);
+    char *tmpfname = NULL;
+    FILE *io = NULL;
+    int okay = 0;
+
+    if (buf == NULL)
+        return;
+
+    // write to a temp file and move it into place, so other readers never
+    //  see a partially-written cache file.
+    tmpfname = pcache_tmpfilename(cachedir, key, m, d);
+    if (tmpfname != NULL)
+    {
+        io = fopen(tmpfname, "wb");
+        if (io != NULL)
+        {
+            okay = (fwrite(buf, len, 1, io) == 1);
+            okay = (fclose(io) == 0) && okay;
+            if ((!okay) || (pcache_rename(tmpfname, fname) != 0))
+                remove(tmpfname);
+        } // if
+        f(tmpfname, d);
+    } // if
+
+    f(buf, d);
+} // pcache_store
+#endif
+
+const MOJOSHADER_parseData *MOJOSHADER_parseCached(const char *cachedir,
+                                                   const char *profile,
+                                                   const char *mainfn,
+                                                   const unsigned char *tokenbuf,
+                                                   const unsigned int bufsize,
+                                                   const MOJOSHADER_swizzle *swiz,
+                                                   const unsigned int swizcount,
+                                                   const MOJOSHADER_samplerMap *smap,
+                                                   const unsigned int smapcount,
+                                                   MOJOSHADER_malloc m,
+                                                   MOJOSHADER_free f, void *d)
+{
+#ifndef MOJOSHADER_USE_SDL_STDLIB
+    const MOJOSHADER_parseData *retval = NULL;
+    MOJOSHADER_malloc cm = (m != NULL) ? m : MOJOSHADER_internal_malloc;
+    MOJOSHADER_free cf = (f != NULL) ? f : MOJOSHADER_internal_free;
+    char *fname = NULL;
+    uint64 key = 0xCBF29CE484222325ULL;
+    unsigned int i;
+
+    if ( (cachedir == NULL) || (profile == NULL) || (bufsize == 0) ||
+         ((m == NULL) && (f != NULL)) || ((m != NULL) && (f == NULL)) )
+    {
+        return MOJOSHADER_parse(profile, mainfn, tokenbuf, bufsize, swiz,
+                                swizcount, smap, smapcount, m, f, d);
+    } // if
+
+    key = pcache_hash(key, pcache_buildconfig, sizeof (pcache_buildconfig));
+    key = pcache_hash_string(key, MOJOSHADER_CHANGESET);
+    key = pcache_hash_string(key, profile);
+    key = pcache_hash_string(key, mainfn);
+    key = pcache_hash(key, &bufsize, sizeof (bufsize));
+    key = pcache_hash(key, tokenbuf, bufsize);
+    for (i = 0; i < swizcount; i++)
+    {
+        key = pcache_hash(key, &swiz[i].usage, sizeof (swiz[i].usage));
+        key = pcache_hash(key, &swiz[i].index, sizeof (swiz[i].index));
+        key = pcache_hash(key, swiz[i].swizzles, sizeof (swiz[i].swizzles));
+    } // for
+    for (i = 0; i < smapcount; i++)
+    {
+        key = pcache_hash(key, &smap[i].index, sizeof (smap[i].index));
+        key = pcache_hash(key, &smap[i].type, sizeof (smap[i].type));
+    } // for
+
+    fname = pcache_filename(cachedir, key, "mojopd", cm, d);
+    if (fname != NULL)
+        retval = pcache_load(fname, cm, cf, d);
+
+    if (retval == NULL)
+    {
+        retval = MOJOSHADER_parse(profile, mainfn, tokenbuf, bufsize, swiz,
+                                  swizcount, smap, smapcount, m, f, d);
+        if ((fname != NULL) && (retval->error_count == 0))
+            pcache_store(cachedir, key, fname, retval, cm, cf, d);
+    } // if
+
+    cf(fname, d);
+    return retval;
+#else
+    // !!! FIXME: use SDL's file i/o for this.
+    return MOJOSHADER_parse(profile, mainfn, tokenbuf, bufsize, swiz,
+                            swizcount, smap, smapcount, m, f, d);
+#endif
+} // MOJOSHADER_parseCached
+
+
+// Batch translation...
+
+typedef struct ParseBatch
+{
+    MOJOSHADER_parseJob *jobs;
+    int jobcount;
+    volatile int next_job;
+    MOJOSHADER_malloc m;
+    MOJOSHADER_free f;
+} ParseBatch;
+
+typedef struct ParseBatchWorker
+{
+    ParseBatch *batch;
+    void *d;
+} ParseBatchWorker;
+
+static int parse_batch_worker(void *_worker)
+{
+    ParseBatchWorker *worker = (ParseBatchWorker *) _worker;
+    ParseBatch *batch = worker->batch;
+    int i;
+
+    // Jobs are claimed one at a time, so a thread that got stuck with a
+    //  huge shader doesn't hold up the smaller ones behind it.
+    while ((i = atomic_add(&batch->next_job, 1)) < batch->jobcount)
+    {
+        MOJOSHADER_parseJob *job = &batch->jobs[i];
+        job->result = MOJOSHADER_parse(job->profile, job->mainfn,
+                                       job->tokenbuf, job->bufsize,
+                                       job->swiz, job->swizcount,
+                                       job->smap, job->smapcount,
+                                       batch->m, batch->f, worker->d);
+    } // while
+
+    return 0;
+} // parse_batch_worker
+
+int MOJOSHADER_parseBatch(MOJOSHADER_parseJob *jobs,
+                          const unsigned int jobcount,
+                          unsigned int threadcount,
+                          MOJOSHADER_malloc m, MOJOSHADER_free f, void *d,
+                          void * const *thread_d)
+{
+    MOJOSHADER_malloc wm = (m != NULL) ? m : MOJOSHADER_internal_malloc;
+    MOJOSHADER_free wf = (f != NULL) ? f : MOJOSHADER_internal_free;
+    ParseBatchWorker *workers = NULL;
+    Thread **threads = NULL;
+    ParseBatch batch;
+    int retval = 1;
+    unsigned int i;
+
+    if (jobcount == 0)
+        return 0;
+
+    if (threadcount == 0)
+    {
+        thread_d = NULL;  // we can't know how long the array would be.
+        threadcount = (unsigned int) cpu_count();
+    } // if
+
+    if (threadcount > jobcount)
+        threadcount = jobcount;
+
+    batch.jobs = jobs;
+    batch.jobcount = (int) jobcount;
+    batch.next_job = 0;
+    batch.m = m;
+    batch.f = f;
+
+    if (threadcount > 1)
+    {
+        workers = (ParseBatchWorker *)
+                    wm(sizeof (ParseBatchWorker) * threadcount, d);
+        threads = (Thread **) wm(sizeof (Thread *) * threadcount, d);
+        if ((workers == NULL) || (threads == NULL))
+            threadcount = 1;  // do it all on this thread, then.
+    } // if
+
+    if (threadcount > 1)
+    {
+        for (i = 0; i < threadcount; i++)
+        {
+            workers[i].batch = &batch;
+            workers[i].d = (thread_d != NULL) ? thread_d[i] : d;
+        } // for
+
+        // Element 0 is this thread, so we don't start a thread for it.
+        threads[0] = NULL;
+        for (i = 1; i < threadcount; i++)
+        {
+            threads[i] = thread_create(parse_batch_worker, &workers[i],
+                                       m, f, d);
+            if (threads[i] != NULL)
+                retval++;
+        } // for
+
+        parse_batch_worker(&workers[0]);
+
+        for (i = 1; i < threadcount; i++)
+            thread_wait(threads[i]);
+    } // if
+    else
+    {
+        ParseBatchWorker worker;
+        worker.batch = &batch;
+        worker.d = (thread_d != NULL) ? thread_d[0] : d;
+        parse_batch_worker(&worker);
+    } // else
+
+    if (threads != NULL)
+        wf(threads, d);
+    if (workers != NULL)
+        wf(workers, d);
+
+    return retval;
+} // MOJOSHADER_parseBatch
+
 #if SUPPORT_PROFILE_SPIRV
 #include <spirv/spirv.h> /* SpvOp, SpvOpConvertUToF, SpvOpConvertSToF, SpvOpCopyObject */
 #endif
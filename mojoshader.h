@@ -892,6 +892,155 @@ DECLSPEC const MOJOSHADER_preshader *MOJOSHADER_parsePreshader(const unsigned ch
 DECLSPEC void MOJOSHADER_freePreshader(const MOJOSHADER_preshader *preshader);
 
 
+/* Translation cache interface... */
+
+/*
+ * This works exactly like MOJOSHADER_parse(), but keeps a persistent copy of
+ *  the results on disk, so the next time you ask for the same translation
+ *  (even in a different process), we skip parsing entirely and just load the
+ *  previous results with a single file read.
+ *
+ * (cachedir) is a directory that MojoShader can read and write files in. It
+ *  must already exist. Each cached translation is a single file in this
+ *  directory, named by a hash of everything that affects the output: the
+ *  bytecode in (tokenbuf), (profile), (mainfn), (swiz) and (smap), plus the
+ *  MojoShader changeset, build options (like MOJOSHADER_FLIP_RENDERTARGET),
+ *  byte order and pointer size of the build that did the translation. You
+ *  can delete these files at any time to clear the cache.
+ *
+ * A MojoShader built outside of a git checkout has no changeset (it reports
+ *  "???"), so two such builds with the same options will share results even
+ *  if they translate differently. Clear the cache when you update a build
+ *  like that.
+ *
+ * Only successful translations are cached; shaders with errors are parsed
+ *  from scratch every time. If (cachedir) is NULL, if (bufsize) is zero (we
+ *  can't hash a buffer of unknown size), or if the cache file can't be read
+ *  or written for any reason, this quietly behaves like MOJOSHADER_parse().
+ *
+ * The returned data is freed with MOJOSHADER_freeParseData(), like any other
+ *  parse result.
+ *
+ * This function is thread safe, so long as (m) and (f) are too, and that
+ *  (tokenbuf) remains intact for the duration of the call. Several threads
+ *  (or processes) may share one (cachedir); each writer uses its own
+ *  temporary file and then moves it into place.
+ */
+DECLSPEC const MOJOSHADER_parseData *MOJOSHADER_parseCached(const char *cachedir,
+                                                            const char *profile,
+                                                            const char *mainfn,
+                                                            const unsigned char *tokenbuf,
+                                                            const unsigned int bufsize,
+                                                            const MOJOSHADER_swizzle *swiz,
+                                                            const unsigned int swizcount,
+                                                            const MOJOSHADER_samplerMap *smap,
+                                                            const unsigned int smapcount,
+                                                            MOJOSHADER_malloc m,
+                                                            MOJOSHADER_free f,
+                                                            void *d);
+
+/*
+ * You almost certainly don't need this function, unless you want to store
+ *  translated shaders somewhere other than MOJOSHADER_parseCached() would.
+ *
+ * Flatten a successful parse result into a single, versioned block of
+ *  memory that can be written out and later handed to
+ *  MOJOSHADER_deserializeParseData(). Everything in the MOJOSHADER_parseData
+ *  is preserved: output, uniforms, constants, samplers, attributes, outputs,
+ *  swizzles, symbols and the preshader.
+ *
+ * The blob is allocated with (m) and must be freed with (f). (*len) is set
+ *  to its size in bytes. Returns NULL if (data) has errors, or if the
+ *  allocator fails.
+ *
+ * The blob is only meaningful to the same build of MojoShader on a CPU with
+ *  the same byte order; it is not an interchange format.
+ *
+ * This function is thread safe, so long as (m) and (f) are too.
+ */
+DECLSPEC void *MOJOSHADER_serializeParseData(const MOJOSHADER_parseData *data,
+                                             unsigned int *len,
+                                             MOJOSHADER_malloc m,
+                                             MOJOSHADER_free f,
+                                             void *d);
+
+/*
+ * Rebuild a MOJOSHADER_parseData from a blob that
+ *  MOJOSHADER_serializeParseData() produced. All data is allocated with
+ *  (m) and (f), and you free the result with MOJOSHADER_freeParseData().
+ *
+ * Returns NULL if the blob is truncated, corrupt, from an incompatible
+ *  version of the format, or the allocator fails. Like
+ *  MOJOSHADER_parsePreshader(), there is no further error reporting.
+ *
+ * This function is thread safe, so long as (m) and (f) are too.
+ */
+DECLSPEC const MOJOSHADER_parseData *MOJOSHADER_deserializeParseData(const void *buf,
+                                                                     const unsigned int len,
+                                                                     MOJOSHADER_malloc m,
+                                                                     MOJOSHADER_free f,
+                                                                     void *d);
+
+
+/* Batch translation interface... */
+
+/*
+ * One shader for MOJOSHADER_parseBatch(). The fields other than (result)
+ *  are exactly the parameters of the same name to MOJOSHADER_parse(), and
+ *  you fill them in. (result) is filled in by MojoShader.
+ */
+typedef struct MOJOSHADER_parseJob
+{
+    const char *profile;
+    const char *mainfn;
+    const unsigned char *tokenbuf;
+    unsigned int bufsize;
+    const MOJOSHADER_swizzle *swiz;
+    unsigned int swizcount;
+    const MOJOSHADER_samplerMap *smap;
+    unsigned int smapcount;
+    const MOJOSHADER_parseData *result;
+} MOJOSHADER_parseJob;
+
+/*
+ * Translate (jobcount) shaders at once, spread across several CPU cores.
+ *
+ * Each element of (jobs) is handed to MOJOSHADER_parse(), and the result
+ *  is stored in that element's (result) field, so results come back in the
+ *  same order as the jobs no matter which thread finished them first. As
+ *  with MOJOSHADER_parse(), no (result) will be NULL when this returns, and
+ *  each one must be freed with MOJOSHADER_freeParseData() when you are done.
+ *
+ * (threadcount) is the maximum number of threads that will work on the
+ *  batch, including the calling thread, which does its share of the work
+ *  and returns when every job is finished. Zero picks one thread per CPU
+ *  core. We never use more threads than there are jobs. If threads aren't
+ *  available, or can't be started, the remaining work is done on the
+ *  calling thread; it's slower, but you get the same results.
+ *
+ * (m), (f) and (d) work like they do for MOJOSHADER_parse(), and must be
+ *  safe to call from several threads at once. If your allocator would
+ *  rather keep separate state for each thread (a per-thread arena, for
+ *  example), pass an array of (threadcount) pointers in (thread_d); each
+ *  thread passes its own element to (m) and (f) instead of (d), and that
+ *  pointer stays with the results that thread produced. (thread_d) may be
+ *  NULL, and must be if (threadcount) is zero.
+ *
+ * Returns the number of threads that did the work.
+ *
+ * This function is thread safe, so long as (m) and (f) are too, and that
+ *  (jobs) and the buffers they point to remain intact for the duration of
+ *  the call.
+ */
+DECLSPEC int MOJOSHADER_parseBatch(MOJOSHADER_parseJob *jobs,
+                                   const unsigned int jobcount,
+                                   unsigned int threadcount,
+                                   MOJOSHADER_malloc m,
+                                   MOJOSHADER_free f,
+                                   void *d,
+                                   void * const *thread_d);
+
+
 /* SPIR-V interface... */
 
 typedef enum
@@ -1033,6 +1182,16 @@ typedef struct MOJOSHADER_preprocessData
  *
  * The callback returns zero on error, non-zero on success.
  *
+ * Your callback is called for every #include, since it might resolve (fname)
+ *  against (parent), or treat (inctype) differently. When MojoShader reads
+ *  the files itself (you passed a NULL includeOpen), (fname) alone decides
+ *  the file, so during one preprocessing run it won't open a file again
+ *  after it was marked "#pragma once", or after it turned out to be entirely
+ *  wrapped in "#ifndef X" ... "#endif" while X is still defined, since
+ *  nothing would come out of it. MOJOSHADER_preprocessPermutations() keeps
+ *  every file open until it returns, so it does this for your callbacks
+ *  too, going by (inctype), (parent), and (fname) together.
+ *
  * If you supply an includeOpen callback, you must supply includeClose, too.
  */
 typedef int (MOJOSHADERCALL *MOJOSHADER_includeOpen)(MOJOSHADER_includeType inctype,
@@ -1057,6 +1216,66 @@ typedef void (MOJOSHADERCALL *MOJOSHADER_includeClose)(const char *data,
                             MOJOSHADER_malloc m, MOJOSHADER_free f, void *d);
 
 
+/* Include cache interface... */
+
+/*
+ * An include cache keeps the contents of #included files in memory between
+ *  calls to MOJOSHADER_preprocess() and MOJOSHADER_preprocessPermutations()
+ *  that you pass it to, so building many shaders that share headers only
+ *  reads each header from disk once.
+ *
+ * The cache only applies when you don't supply include callbacks, and
+ *  MojoShader opens files itself. Files are keyed by the name on the #include
+ *  line, exactly as we'd open it. Every #include still checks the file's
+ *  size and modification time, and reads it again if either changed.
+ */
+typedef struct MOJOSHADER_includeCache MOJOSHADER_includeCache;
+
+/*
+ * Counters for an include cache, since it was created.
+ *  See MOJOSHADER_getIncludeCacheStats().
+ */
+typedef struct MOJOSHADER_includeCacheStats
+{
+    unsigned int hits;     /* #include served from memory */
+    unsigned int misses;   /* had to read the file */
+    unsigned int reloads;  /* ...because it changed since we cached it */
+    unsigned int files;    /* in the cache right now */
+    unsigned int bytes;    /* ...and their total size */
+} MOJOSHADER_includeCacheStats;
+
+/*
+ * Create an empty include cache.
+ *
+ * The cache allocates file contents with (m), (f) and (d), not with the
+ *  allocator of whatever call first read the file. If you don't care, pass
+ *  NULL for the allocator functions.
+ *
+ * Returns NULL if out of memory, or if this build of MojoShader can't open
+ *  files itself (MOJOSHADER_FORCE_INCLUDE_CALLBACKS).
+ *
+ * This function is thread safe, so long as (m) and (f) are too. One cache
+ *  may be shared by any number of threads.
+ */
+DECLSPEC MOJOSHADER_includeCache *MOJOSHADER_createIncludeCache(MOJOSHADER_malloc m,
+                                                              MOJOSHADER_free f,
+                                                              void *d);
+
+/*
+ * Fill in (stats) for (cache).
+ *
+ * This function is thread safe.
+ */
+DECLSPEC void MOJOSHADER_getIncludeCacheStats(MOJOSHADER_includeCache *cache,
+                                              MOJOSHADER_includeCacheStats *stats);
+
+/*
+ * Free (cache) and everything in it. No call that you passed it to may still
+ *  be running when you call this. Passing a NULL here is a safe no-op.
+ */
+DECLSPEC void MOJOSHADER_destroyIncludeCache(MOJOSHADER_includeCache *cache);
+
+
 /*
  * This function is optional. Even if you are dealing with shader source
  *  code, you don't need to explicitly use the preprocessor, as the compiler
@@ -1092,6 +1311,10 @@ typedef void (MOJOSHADERCALL *MOJOSHADER_includeClose)(const char *data,
  *  behaviour for #include statements. Both are optional and can be NULL, but
  *  both must be specified if either is specified.
  *
+ * (include_cache) keeps #included files in memory for later calls that get
+ *  the same cache. It can be NULL, and is ignored if you supply include
+ *  callbacks. See MOJOSHADER_createIncludeCache().
+ *
  * This will return a MOJOSHADER_preprocessorData. You should pass this
  *  return value to MOJOSHADER_freePreprocessData() when you are done with
  *  it.
@@ -1119,6 +1342,7 @@ DECLSPEC const MOJOSHADER_preprocessData *MOJOSHADER_preprocess(const char *file
                              unsigned int define_count,
                              MOJOSHADER_includeOpen include_open,
                              MOJOSHADER_includeClose include_close,
+                             MOJOSHADER_includeCache *include_cache,
                              MOJOSHADER_malloc m, MOJOSHADER_free f, void *d);
 
 
@@ -1134,6 +1358,116 @@ DECLSPEC const MOJOSHADER_preprocessData *MOJOSHADER_preprocess(const char *file
 DECLSPEC void MOJOSHADER_freePreprocessData(const MOJOSHADER_preprocessData *data);
 
 
+/*
+ * One set of predefined macros for MOJOSHADER_preprocessPermutations().
+ *  (defines) points to (define_count) elements, just like the arguments to
+ *  MOJOSHADER_preprocess().
+ */
+typedef struct MOJOSHADER_preprocessPermutation
+{
+    const MOJOSHADER_preprocessorDefine *defines;
+    unsigned int define_count;
+} MOJOSHADER_preprocessPermutation;
+
+/*
+ * Results from MOJOSHADER_preprocessPermutations(). Permutations that
+ *  preprocess to the same thing share one MOJOSHADER_preprocessData.
+ */
+typedef struct MOJOSHADER_preprocessPermutationData
+{
+    /*
+     * The number of permutations you passed in.
+     */
+    int permutation_count;
+
+    /*
+     * (permutation_count) elements: permutation (i) produced
+     *  outputs[output_index[i]].
+     */
+    int *output_index;
+
+    /*
+     * The number of elements pointed to by (outputs).
+     */
+    int output_count;
+
+    /*
+     * (output_count) results, each just like you'd get from
+     *  MOJOSHADER_preprocess(), errors and all. Don't free these yourself;
+     *  MOJOSHADER_freePreprocessPermutationData() will do it.
+     */
+    const MOJOSHADER_preprocessData **outputs;
+
+    /*
+     * This is the malloc implementation you passed to
+     *  MOJOSHADER_preprocessPermutations().
+     */
+    MOJOSHADER_malloc malloc;
+
+    /*
+     * This is the free implementation you passed to
+     *  MOJOSHADER_preprocessPermutations().
+     */
+    MOJOSHADER_free free;
+
+    /*
+     * This is the pointer you passed as opaque data for your allocator.
+     */
+    void *malloc_data;
+} MOJOSHADER_preprocessPermutationData;
+
+/*
+ * Preprocess one source once for each of (permutation_count) sets of
+ *  predefined macros. Every permutation gets the same results as calling
+ *  MOJOSHADER_preprocess() with its defines would produce, but this
+ *  shares work between them:
+ *
+ *  - Each #included file is opened once, and every permutation uses that
+ *    copy. If you supply include callbacks, they are called once for each
+ *    distinct (inctype, parent, fname), and (include_close) runs when this
+ *    function returns.
+ *  - While preprocessing a permutation, we note which of the predefined
+ *    macros it actually looked at: the ones in an #if or #ifdef, and the ones
+ *    expanded in the source. A later permutation that agrees with it on all
+ *    of those can't come out any differently, so it shares the earlier
+ *    result instead of being preprocessed again. Permutations whose defines
+ *    only vary in macros this source never uses collapse to one output.
+ *
+ * Only permutations whose defines are all plain object-like macros (a
+ *  simple identifier, with a definition that has no newlines, backslashes,
+ *  quotes, '#', or comments) are candidates for sharing; anything fancier is
+ *  always preprocessed on its own.
+ *
+ * The other arguments work like MOJOSHADER_preprocess().
+ *
+ * Returns NULL if out of memory. Otherwise, pass the return value to
+ *  MOJOSHADER_freePreprocessPermutationData() when you are done with it.
+ *
+ * This function is thread safe, so long as the various callback functions
+ *  are, too, and that the parameters remains intact for the duration of the
+ *  call.
+ */
+DECLSPEC const MOJOSHADER_preprocessPermutationData *MOJOSHADER_preprocessPermutations(
+                             const char *filename,
+                             const char *source, unsigned int sourcelen,
+                             const MOJOSHADER_preprocessPermutation *permutations,
+                             unsigned int permutation_count,
+                             MOJOSHADER_includeOpen include_open,
+                             MOJOSHADER_includeClose include_close,
+                             MOJOSHADER_includeCache *include_cache,
+                             MOJOSHADER_malloc m, MOJOSHADER_free f, void *d);
+
+/*
+ * Call this to dispose of the results of MOJOSHADER_preprocessPermutations(),
+ *  including every MOJOSHADER_preprocessData in it. Passing a NULL here is a
+ *  safe no-op.
+ *
+ * This function is thread safe, so long as any allocator you passed into
+ *  MOJOSHADER_preprocessPermutations() is, too.
+ */
+DECLSPEC void MOJOSHADER_freePreprocessPermutationData(const MOJOSHADER_preprocessPermutationData *data);
+
+
 /* Assembler interface... */
 
 /*
@@ -2754,6 +3088,37 @@ DECLSPEC MOJOSHADER_glShader *MOJOSHADER_glCompileShader(const unsigned char *to
                                                          const MOJOSHADER_samplerMap *smap,
                                                          const unsigned int smapcount);
 
+/*
+ * Compile a shader that was already translated, usually on another thread
+ *  with MOJOSHADER_parse() or MOJOSHADER_parseBatch().
+ *
+ * This is the second half of MOJOSHADER_glCompileShader(); that function
+ *  translates the bytecode and then calls this one.
+ *
+ *   (pd) must have been translated to the current context's profile, the
+ *   one MOJOSHADER_glCreateContext() was given. Profiles that extend
+ *   another one, like "glsl120", report their base profile in the parse
+ *   data, so only that base profile can be checked here. This function
+ *   takes ownership of (pd) either way: on success it belongs to the
+ *   returned shader (see MOJOSHADER_glGetShaderParseData()), and on
+ *   failure it is freed.
+ *
+ * Returns NULL on error, or a shader handle on success.
+ *
+ * This can be used for an effect's compileParsedShader; see
+ *  MOJOSHADER_compileEffectThreaded().
+ *
+ * This call is NOT thread safe! As most OpenGL implementations are not thread
+ *  safe, you should probably only call this from the same thread that created
+ *  the GL context.
+ *
+ * This call requires a valid MOJOSHADER_glContext to have been made current,
+ *  or it will crash your program. See MOJOSHADER_glMakeContextCurrent().
+ *
+ * Compiled shaders from this function may not be shared between contexts.
+ */
+DECLSPEC MOJOSHADER_glShader *MOJOSHADER_glCompileParsedShader(const MOJOSHADER_parseData *pd);
+
 /*
  * Increments a shader's internal refcount. To decrement the refcount, call
  *  MOJOSHADER_glDeleteShader().
@@ -2834,7 +3199,8 @@ DECLSPEC void MOJOSHADER_glBindProgram(MOJOSHADER_glProgram *program);
  *  programs linked here. Programs are removed from this cache when one of the
  *  invidual shaders in it is deleted, otherwise they remain cached so future
  *  calls to this function don't need to relink a previously-used shader
- *  grouping.
+ *  grouping. By default the cache never forgets a grouping; see
+ *  MOJOSHADER_glSetLinkerCacheCapacity() to bound it.
  *
  * This function is for convenience, as the API is closer to how Direct3D
  *  works, and retrofitting linking into your app can be difficult;
@@ -2869,6 +3235,71 @@ DECLSPEC void MOJOSHADER_glBindShaders(MOJOSHADER_glShader *vshader,
 DECLSPEC void MOJOSHADER_glGetBoundShaders(MOJOSHADER_glShader **vshader,
                                            MOJOSHADER_glShader **pshader);
 
+/*
+ * Limit how many programs MOJOSHADER_glBindShaders() keeps linked.
+ *
+ * When binding a new shader grouping would go past (capacity) cached
+ *  programs, the one that was bound least recently is dropped from the
+ *  cache, and deleted. If it's still bound, it stays alive until it isn't.
+ *  Binding it again later means linking it again.
+ *
+ * (capacity) is the most programs to cache, or zero for no limit, which is
+ *  the default. If more than that are cached already, the least recently
+ *  used are dropped right away.
+ *
+ * This call is NOT thread safe! As most OpenGL implementations are not thread
+ *  safe, you should probably only call this from the same thread that created
+ *  the GL context.
+ *
+ * This call requires a valid MOJOSHADER_glContext to have been made current,
+ *  or it will crash your program. See MOJOSHADER_glMakeContextCurrent().
+ */
+DECLSPEC void MOJOSHADER_glSetLinkerCacheCapacity(unsigned int capacity);
+
+/*
+ * Drop the least recently used programs from MOJOSHADER_glBindShaders()'s
+ *  cache, until no more than (count) are left. Zero empties the cache. This
+ *  is a good thing to do after a level change, say, when a lot of shaders
+ *  won't be needed again.
+ *
+ * This call is NOT thread safe! As most OpenGL implementations are not thread
+ *  safe, you should probably only call this from the same thread that created
+ *  the GL context.
+ *
+ * This call requires a valid MOJOSHADER_glContext to have been made current,
+ *  or it will crash your program. See MOJOSHADER_glMakeContextCurrent().
+ */
+DECLSPEC void MOJOSHADER_glTrimLinkerCache(unsigned int count);
+
+/*
+ * Counters for MOJOSHADER_glBindShaders()'s program cache, since the context
+ *  was created. See MOJOSHADER_glGetLinkerCacheStats().
+ */
+typedef struct MOJOSHADER_glLinkerCacheStats
+{
+    unsigned int hits;       /* bound a cached program */
+    unsigned int misses;     /* had to link a new one */
+    unsigned int links;      /* ...and linking worked */
+    unsigned int evictions;  /* dropped for capacity or by a trim */
+    unsigned int cached_programs;  /* in the cache right now */
+    unsigned int live_programs;    /* all programs alive in this context,
+                                      including MOJOSHADER_glLinkProgram()'s */
+} MOJOSHADER_glLinkerCacheStats;
+
+/*
+ * Fill in (stats) for the current context.
+ *
+ * This is a "fast" call; we're just reading from internal memory.
+ *
+ * This call is NOT thread safe! As most OpenGL implementations are not thread
+ *  safe, you should probably only call this from the same thread that created
+ *  the GL context.
+ *
+ * This call requires a valid MOJOSHADER_glContext to have been made current,
+ *  or it will crash your program. See MOJOSHADER_glMakeContextCurrent().
+ */
+DECLSPEC void MOJOSHADER_glGetLinkerCacheStats(MOJOSHADER_glLinkerCacheStats *stats);
+
 /*
  * Set a floating-point uniform value (what Direct3D calls a "constant").
  *
@@ -3170,6 +3601,13 @@ DECLSPEC void MOJOSHADER_glMapUniformBufferMemory(float **vsf, int **vsi, unsign
  * Tells the context that you are done with the memory mapped by
  *  MOJOSHADER_glMapUniformBufferMemory().
  *
+ * Since the context can't know which registers you touched through the
+ *  mapped pointers, the next MOJOSHADER_glProgramReady() for each program
+ *  will compare all of its registers against what it last uploaded. It
+ *  still only uploads the ones that changed, but it can't skip the check.
+ *  The effects framework always sets parameters through this path, so
+ *  effects don't get the cheaper check; only the smaller uploads.
+ *
  * This call is NOT thread safe! As most OpenGL implementations are not thread
  *  safe, you should probably only call this from the same thread that created
  *  the GL context.
@@ -3290,6 +3728,19 @@ DECLSPEC void MOJOSHADER_glSetVertexAttribDivisor(MOJOSHADER_usage usage,
  *  before you start drawing, so any outstanding changes made to the shared
  *  constants array (etc) can propagate to the shader during this call.
  *
+ * Only the registers that changed since this program was last made ready
+ *  are uploaded. When those changes came through the
+ *  MOJOSHADER_glSetVertexShaderUniformF() family of functions, the context
+ *  also knows which registers to look at, and skips the rest. After
+ *  MOJOSHADER_glUnmapUniformBufferMemory() it doesn't, so every program
+ *  compares all of its registers against what it last uploaded the next
+ *  time it's made ready.
+ *
+ * If MojoShader was built with MOJOSHADER_GLSL_UNIFORM_BUFFERS defined, GLSL
+ *  programs keep their float uniforms in uniform buffers, and this call
+ *  binds them to GL_UNIFORM_BUFFER binding points 0 (vertex shader) and 1
+ *  (pixel shader). Don't bind anything else to those two points.
+ *
  * This call is NOT thread safe! As most OpenGL implementations are not thread
  *  safe, you should probably only call this from the same thread that created
  *  the GL context.
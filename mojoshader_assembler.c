@@ -1489,7 +1489,7 @@ static Context *build_context(const char *filename,
 
     ctx->preprocessor = preprocessor_start(filename, source, sourcelen,
                                            include_open, include_close,
-                                           defines, define_count, 1,
+                                           NULL, defines, define_count, 1,
                                            MallocBridge, FreeBridge, ctx);
 
     if (ctx->preprocessor == NULL)
@@ -29,17 +29,36 @@ MOJOSHADER_parseData MOJOSHADER_out_of_mem_data = {
 };
 
 
+// Hashtables are open-addressed with linear probing: keys and values live
+//  right in the slot array, so there's no allocation per insert, and the
+//  table doubles in size when it gets too full. Removed slots are marked
+//  as tombstones instead of shuffling their neighbors around, which keeps
+//  hash_iter_keys() stable if you remove the key it just handed you.
+//  Tombstones get cleaned out whenever the table is rebuilt.
+//
+// Stackable tables allow duplicate keys; the most recent insert shadows
+//  the others until it's removed. Each slot remembers when it was inserted
+//  so we can always find the newest one, no matter where the probing put it.
+
+#define HASHITEM_EMPTY 0
+#define HASHITEM_DELETED 0xFFFFFFFF
+
 typedef struct HashItem
 {
     const void *key;
     const void *value;
-    struct HashItem *next;
+    uint32 hash;
+    uint32 age;  // HASHITEM_EMPTY, HASHITEM_DELETED, or insertion order.
 } HashItem;
 
 struct HashTable
 {
-    HashItem **table;
-    uint32 table_len;
+    HashItem *table;
+    uint32 table_len;  // always a power of two.
+    uint32 table_bits;  // log2(table_len)
+    uint32 count;  // live items.
+    uint32 deleted;  // tombstones.
+    uint32 next_age;
     int stackable;
     void *data;
     HashTable_HashFn hash;
@@ -50,62 +69,121 @@ struct HashTable
     void *d;
 };
 
-static inline uint32 calc_hash(const HashTable *table, const void *key)
+// Fibonacci hashing: scatter the hash function's bits across the table
+//  index, so weak hashes (pointers, small integers) don't pile up in one
+//  long probe run.
+static inline uint32 calc_slot(const HashTable *table, const uint32 hash)
 {
-    return table->hash(key, table->data) & (table->table_len-1);
-} // calc_hash
+    return (uint32) (hash * 0x9E3779B9u) >> (32 - table->table_bits);
+} // calc_slot
 
-int hash_find(const HashTable *table, const void *key, const void **_value)
+static inline int is_live(const HashItem *item)
 {
-    HashItem *i;
-    void *data = table->data;
-    const uint32 hash = calc_hash(table, key);
-    HashItem *prev = NULL;
-    for (i = table->table[hash]; i != NULL; i = i->next)
+    return ((item->age != HASHITEM_EMPTY) && (item->age != HASHITEM_DELETED));
+} // is_live
+
+// Find the newest live item for (key) with an age less than (maxage).
+static HashItem *find_item(const HashTable *table, const void *key,
+                           const uint32 hash, const uint32 maxage)
+{
+    const uint32 mask = table->table_len - 1;
+    uint32 idx = calc_slot(table, hash);
+    HashItem *retval = NULL;
+    uint32 i;
+
+    for (i = 0; i < table->table_len; i++, idx = (idx + 1) & mask)
     {
-        if (table->keymatch(key, i->key, data))
-        {
-            if (_value != NULL)
-                *_value = i->value;
+        HashItem *item = &table->table[idx];
+        if (item->age == HASHITEM_EMPTY)
+            break;  // end of the probe run, nothing further can match.
+        else if ((item->age == HASHITEM_DELETED) || (item->hash != hash))
+            continue;
+        else if (item->age >= maxage)
+            continue;
+        else if ((retval != NULL) && (item->age < retval->age))
+            continue;
+        else if (!table->keymatch(key, item->key, table->data))
+            continue;
 
-            // Matched! Move to the front of list for faster lookup next time.
-            //  (stackable tables have to remain in the same order, though!)
-            if ((!table->stackable) && (prev != NULL))
-            {
-                assert(prev->next == i);
-                prev->next = i->next;
-                i->next = table->table[hash];
-                table->table[hash] = i;
-            } // if
+        retval = item;
+        if (!table->stackable)
+            break;  // there can be only one.
+    } // for
 
-            return 1;
-        } // if
+    return retval;
+} // find_item
 
-        prev = i;
+static void place_item(HashTable *table, const HashItem *src)
+{
+    const uint32 mask = table->table_len - 1;
+    uint32 idx = calc_slot(table, src->hash);
+    while (is_live(&table->table[idx]))
+        idx = (idx + 1) & mask;
+    if (table->table[idx].age == HASHITEM_DELETED)
+        table->deleted--;
+    table->table[idx] = *src;
+    table->count++;
+} // place_item
+
+static int rehash(HashTable *table, const uint32 new_bits)
+{
+    HashItem *old = table->table;
+    const uint32 old_len = table->table_len;
+    const uint32 new_len = ((uint32) 1) << new_bits;
+    HashItem *items = (HashItem *) table->m(sizeof (HashItem) * new_len,
+                                            table->d);
+    uint32 i;
+
+    if (items == NULL)
+        return 0;
+
+    memset(items, '\0', sizeof (HashItem) * new_len);
+    table->table = items;
+    table->table_len = new_len;
+    table->table_bits = new_bits;
+    table->count = 0;
+    table->deleted = 0;
+
+    for (i = 0; i < old_len; i++)
+    {
+        if (is_live(&old[i]))
+            place_item(table, &old[i]);
     } // for
 
-    return 0;
+    table->f(old, table->d);
+    return 1;
+} // rehash
+
+int hash_find(const HashTable *table, const void *key, const void **_value)
+{
+    const uint32 hash = table->hash(key, table->data);
+    const HashItem *item = find_item(table, key, hash, HASHITEM_DELETED);
+    if (item == NULL)
+        return 0;
+
+    if (_value != NULL)
+        *_value = item->value;
+    return 1;
 } // hash_find
 
 int hash_iter(const HashTable *table, const void *key,
               const void **_value, void **iter)
 {
-    HashItem *item = (HashItem *) *iter;
-    if (item == NULL)
-        item = table->table[calc_hash(table, key)];
-    else
-        item = item->next;
+    // (*iter) is the age of the last match, so we can find the next
+    //  oldest one, even if the table grew in the meantime.
+    const uint32 maxage = (*iter == NULL) ? HASHITEM_DELETED :
+                                (uint32) (size_t) *iter;
+    const HashItem *item = NULL;
 
-    while (item != NULL)
+    if ((maxage == HASHITEM_DELETED) || (table->stackable))
+        item = find_item(table, key, table->hash(key, table->data), maxage);
+
+    if (item != NULL)
     {
-        if (table->keymatch(key, item->key, table->data))
-        {
-            *_value = item->value;
-            *iter = item;
-            return 1;
-        } // if
-        item = item->next;
-    } // while
+        *_value = item->value;
+        *iter = (void *) (size_t) item->age;
+        return 1;
+    } // if
 
     // no more matches.
     *_value = NULL;
@@ -115,49 +193,55 @@ int hash_iter(const HashTable *table, const void *key,
 
 int hash_iter_keys(const HashTable *table, const void **_key, void **iter)
 {
-    HashItem *item = (HashItem *) *iter;
-    uint32 idx = 0;
-
-    if (item != NULL)
-    {
-        const HashItem *orig = item;
-        item = item->next;
-        if (item == NULL)
-            idx = calc_hash(table, orig->key) + 1;
-    } // if
+    // (*iter) is one past the index of the last slot we reported.
+    uint32 idx = (uint32) (size_t) *iter;
 
-    while (!item && (idx < table->table_len))
-        item = table->table[idx++];  // skip empty buckets...
+    while ((idx < table->table_len) && (!is_live(&table->table[idx])))
+        idx++;  // skip empty slots...
 
-    if (item == NULL)  // no more matches?
+    if (idx >= table->table_len)  // no more matches?
     {
         *_key = NULL;
         *iter = NULL;
         return 0;
     } // if
 
-    *_key = item->key;
-    *iter = item;
+    *_key = table->table[idx].key;
+    *iter = (void *) (size_t) (idx + 1);
     return 1;
 } // hash_iter_keys
 
 int hash_insert(HashTable *table, const void *key, const void *value)
 {
-    HashItem *item = NULL;
-    const uint32 hash = calc_hash(table, key);
-    if ( (!table->stackable) && (hash_find(table, key, NULL)) )
+    HashItem item;
+    const uint32 hash = table->hash(key, table->data);
+    if ( (!table->stackable) && (find_item(table, key, hash, HASHITEM_DELETED)) )
         return 0;
 
-    // !!! FIXME: grow and rehash table if it gets too saturated.
-    item = (HashItem *) table->m(sizeof (HashItem), table->d);
-    if (item == NULL)
-        return -1;
+    // Keep the table at most 3/4 full, counting tombstones, since they
+    //  make probe runs longer, too. If it's mostly tombstones, rebuilding
+    //  at the same size is enough to clean them out.
+    if ( ((table->count + table->deleted + 1) * 4) > (table->table_len * 3) )
+    {
+        const uint32 bits = table->table_bits;
+        const int grow = ((table->count + 1) * 2) > table->table_len;
+        if ((grow) && (bits >= 31))
+            return -1;
+        else if (!rehash(table, grow ? bits + 1 : bits))
+            return -1;
+    } // if
 
-    item->key = key;
-    item->value = value;
-    item->next = table->table[hash];
-    table->table[hash] = item;
+    // We don't reuse ages, so there's a (very large) limit to the total
+    //  number of inserts a stackable table can take over its lifetime.
+    assert(table->next_age < HASHITEM_DELETED);
+    if (table->next_age >= HASHITEM_DELETED)
+        return -1;
 
+    item.key = key;
+    item.value = value;
+    item.hash = hash;
+    item.age = table->stackable ? table->next_age++ : 1;
+    place_item(table, &item);
     return 1;
 } // hash_insert
 
@@ -167,14 +251,15 @@ HashTable *hash_create(void *data, const HashTable_HashFn hashfn,
               const int stackable,
               MOJOSHADER_malloc m, MOJOSHADER_free f, void *d)
 {
-    const uint32 initial_table_size = 256;
-    const uint32 alloc_len = sizeof (HashItem *) * initial_table_size;
+    const uint32 initial_table_bits = 4;
+    const uint32 initial_table_size = ((uint32) 1) << initial_table_bits;
+    const uint32 alloc_len = sizeof (HashItem) * initial_table_size;
     HashTable *table = (HashTable *) m(sizeof (HashTable), d);
     if (table == NULL)
         return NULL;
     memset(table, '\0', sizeof (HashTable));
 
-    table->table = (HashItem **) m(alloc_len, d);
+    table->table = (HashItem *) m(alloc_len, d);
     if (table->table == NULL)
     {
         f(table, d);
@@ -183,6 +268,8 @@ HashTable *hash_create(void *data, const HashTable_HashFn hashfn,
 
     memset(table->table, '\0', alloc_len);
     table->table_len = initial_table_size;
+    table->table_bits = initial_table_bits;
+    table->next_age = 1;
     table->stackable = stackable;
     table->data = data;
     table->hash = hashfn;
@@ -202,14 +289,9 @@ void hash_destroy(HashTable *table, const void *ctx)
     void *d = table->d;
     for (i = 0; i < table->table_len; i++)
     {
-        HashItem *item = table->table[i];
-        while (item != NULL)
-        {
-            HashItem *next = item->next;
+        const HashItem *item = &table->table[i];
+        if (is_live(item))
             table->nuke(ctx, item->key, item->value, data);
-            f(item, d);
-            item = next;
-        } // while
     } // for
 
     f(table->table, d);
@@ -218,28 +300,20 @@ void hash_destroy(HashTable *table, const void *ctx)
 
 int hash_remove(HashTable *table, const void *key, const void *ctx)
 {
-    HashItem *item = NULL;
-    HashItem *prev = NULL;
-    void *data = table->data;
-    const uint32 hash = calc_hash(table, key);
-    for (item = table->table[hash]; item != NULL; item = item->next)
-    {
-        if (table->keymatch(key, item->key, data))
-        {
-            if (prev != NULL)
-                prev->next = item->next;
-            else
-                table->table[hash] = item->next;
-
-            table->nuke(ctx, item->key, item->value, data);
-            table->f(item, table->d);
-            return 1;
-        } // if
-
-        prev = item;
-    } // for
+    const uint32 hash = table->hash(key, table->data);
+    HashItem *item = find_item(table, key, hash, HASHITEM_DELETED);
+    if (item == NULL)
+        return 0;
 
-    return 0;
+    // Mark it dead before nuking, in case the nuke callback looks at us.
+    const void *k = item->key;
+    const void *v = item->value;
+    item->age = HASHITEM_DELETED;
+    item->key = item->value = NULL;
+    table->count--;
+    table->deleted++;
+    table->nuke(ctx, k, v, table->data);
+    return 1;
 } // hash_remove
 
 
@@ -339,23 +413,47 @@ int stringmap_find(const StringMap *smap, const char *key, const char **_value)
 } // stringmap_find
 
 
-// The string cache...   !!! FIXME: use StringMap internally for this.
+// The string cache...
 
+// Cached strings live right after their StringBucket, and the buckets are
+//  the keys in a HashTable. Lookups use a StringBucket on the stack that
+//  points at the caller's (not necessarily null-terminated) string.
 typedef struct StringBucket
 {
-    char *string;
-    struct StringBucket *next;
+    const char *string;
+    uint32 len;
 } StringBucket;
 
 struct StringCache
 {
-    StringBucket **hashtable;
-    uint32 table_size;
+    HashTable *hashtable;
     MOJOSHADER_malloc m;
     MOJOSHADER_free f;
     void *d;
 };
 
+static uint32 stringcache_hash(const void *key, void *data)
+{
+    const StringBucket *bucket = (const StringBucket *) key;
+    (void) data;
+    return hash_string(bucket->string, bucket->len);
+} // stringcache_hash
+
+static int stringcache_keymatch(const void *a, const void *b, void *data)
+{
+    const StringBucket *bucketa = (const StringBucket *) a;
+    const StringBucket *bucketb = (const StringBucket *) b;
+    (void) data;
+    return ( (bucketa->len == bucketb->len) &&
+             (memcmp(bucketa->string, bucketb->string, bucketa->len) == 0) );
+} // stringcache_keymatch
+
+static void stringcache_nuke(const void *ctx, const void *key,
+                             const void *value, void *data)
+{
+    StringCache *cache = (StringCache *) data;
+    cache->f((void *) key, cache->d);
+} // stringcache_nuke
 
 const char *stringcache(StringCache *cache, const char *str)
 {
@@ -367,42 +465,34 @@ static const char *stringcache_len_internal(StringCache *cache,
                                             const unsigned int len,
                                             const int addmissing)
 {
-    const uint8 hash = hash_string(str, len) & (cache->table_size-1);
-    StringBucket *bucket = cache->hashtable[hash];
-    StringBucket *prev = NULL;
-    while (bucket)
-    {
-        const char *bstr = bucket->string;
-        if ((strncmp(bstr, str, len) == 0) && (bstr[len] == 0))
-        {
-            // Matched! Move this to the front of the list.
-            if (prev != NULL)
-            {
-                assert(prev->next == bucket);
-                prev->next = bucket->next;
-                bucket->next = cache->hashtable[hash];
-                cache->hashtable[hash] = bucket;
-            } // if
-            return bstr; // already cached
-        } // if
-        prev = bucket;
-        bucket = bucket->next;
-    } // while
+    StringBucket key;
+    const void *value = NULL;
+    key.string = str;
+    key.len = len;
+
+    if (hash_find(cache->hashtable, &key, &value))
+        return (const char *) value;  // already cached
 
     // no match!
     if (!addmissing)
         return NULL;
 
     // add to the table.
+    StringBucket *bucket;
     bucket = (StringBucket *) cache->m(sizeof (StringBucket) + len + 1, cache->d);
     if (bucket == NULL)
         return NULL;
-    bucket->string = (char *)(bucket + 1);
-    memcpy(bucket->string, str, len);
-    bucket->string[len] = '\0';
-    bucket->next = cache->hashtable[hash];
-    cache->hashtable[hash] = bucket;
-    return bucket->string;
+    char *string = (char *)(bucket + 1);
+    memcpy(string, str, len);
+    string[len] = '\0';
+    bucket->string = string;
+    bucket->len = len;
+    if (hash_insert(cache->hashtable, bucket, string) != 1)
+    {
+        cache->f(bucket, cache->d);
+        return NULL;
+    } // if
+    return string;
 } // stringcache_len_internal
 
 const char *stringcache_len(StringCache *cache, const char *str,
@@ -447,22 +537,20 @@ const char *stringcache_fmt(StringCache *cache, const char *fmt, ...)
 
 StringCache *stringcache_create(MOJOSHADER_malloc m, MOJOSHADER_free f, void *d)
 {
-    const uint32 initial_table_size = 256;
-    const size_t tablelen = sizeof (StringBucket *) * initial_table_size;
     StringCache *cache = (StringCache *) m(sizeof (StringCache), d);
     if (!cache)
         return NULL;
     memset(cache, '\0', sizeof (StringCache));
 
-    cache->hashtable = (StringBucket **) m(tablelen, d);
+    cache->hashtable = hash_create(cache, stringcache_hash,
+                                   stringcache_keymatch, stringcache_nuke,
+                                   0, m, f, d);
     if (!cache->hashtable)
     {
         f(cache, d);
         return NULL;
     } // if
-    memset(cache->hashtable, '\0', tablelen);
 
-    cache->table_size = initial_table_size;
     cache->m = m;
     cache->f = f;
     cache->d = d;
@@ -474,24 +562,8 @@ void stringcache_destroy(StringCache *cache)
     if (cache == NULL)
         return;
 
-    MOJOSHADER_free f = cache->f;
-    void *d = cache->d;
-    size_t i;
-
-    for (i = 0; i < cache->table_size; i++)
-    {
-        StringBucket *bucket = cache->hashtable[i];
-        cache->hashtable[i] = NULL;
-        while (bucket)
-        {
-            StringBucket *next = bucket->next;
-            f(bucket, d);
-            bucket = next;
-        } // while
-    } // for
-
-    f(cache->hashtable, d);
-    f(cache, d);
+    hash_destroy(cache->hashtable, NULL);
+    cache->f(cache, cache->d);
 } // stringcache_destroy
 
 
@@ -866,22 +938,21 @@ char *buffer_flatten(Buffer *buffer)
     return retval;
 } // buffer_flatten
 
-char *buffer_merge(Buffer **buffers, const size_t n, size_t *_len)
+char *buffer_merge(Buffer **buffers, const size_t n, size_t *_len,
+                   MOJOSHADER_malloc m, void *d)
 {
-    Buffer *first = NULL;
     size_t len = 0;
     size_t i;
     for (i = 0; i < n; i++)
     {
         Buffer *buffer = buffers[i];
-        if (buffer == NULL)
-            continue;
-        if (first == NULL)
-            first = buffer;
-        len += buffer->total_bytes;
+        if (buffer != NULL)
+            len += buffer->total_bytes;
     } // for
 
-    char *retval = (char *) (first ? first->m(len + 1, first->d) : NULL);
+    // (m) might not be the allocator the buffers use, so the results can
+    //  outlive the buffers' memory (a parse Context's arena, for example).
+    char *retval = (char *) m(len + 1, d);
     if (retval == NULL)
     {
         *_len = 0;
@@ -970,6 +1041,332 @@ void buffer_patch(Buffer *buffer, const size_t start,
     } // while
 } // buffer_patch
 
+
+// Arena allocator...
+
+// Everything we hand out is aligned to this, which is enough for any of
+//  the structs we put in here.
+#define ARENA_ALIGNMENT 16
+#define ARENA_ALIGN(x) (((x) + (ARENA_ALIGNMENT - 1)) & ~((size_t) (ARENA_ALIGNMENT - 1)))
+
+void arena_init(Arena *arena, size_t blksz,
+                MOJOSHADER_malloc m, MOJOSHADER_free f, void *d)
+{
+    memset(arena, '\0', sizeof (Arena));
+    arena->block_size = blksz;
+    arena->m = m;
+    arena->f = f;
+    arena->d = d;
+} // arena_init
+
+void *arena_alloc(Arena *arena, const size_t _len)
+{
+    const size_t header = ARENA_ALIGN(sizeof (ArenaBlock));
+    const size_t len = ARENA_ALIGN((_len == 0) ? 1 : _len);
+    ArenaBlock *block = arena->head;
+
+    if ((block == NULL) || ((block->bytes - block->used) < len))
+    {
+        // Anything over a quarter block gets a block of its own, so we
+        //  don't throw away most of the current one to fit it.
+        const int oversized = (len > (arena->block_size / 4));
+        const size_t bytes = oversized ? len : arena->block_size;
+        block = (ArenaBlock *) arena->m((int) (header + bytes), arena->d);
+        if (block == NULL)
+            return NULL;
+
+        block->used = 0;
+        block->bytes = bytes;
+        arena->blocks++;
+
+        if ((oversized) && (arena->head != NULL))
+        {
+            // keep filling the current block after this.
+            block->next = arena->head->next;
+            arena->head->next = block;
+        } // if
+        else
+        {
+            block->next = arena->head;
+            arena->head = block;
+        } // else
+    } // if
+
+    void *retval = ((uint8 *) block) + header + block->used;
+    block->used += len;
+    arena->allocations++;
+    return retval;
+} // arena_alloc
+
+void arena_destroy(Arena *arena)
+{
+    ArenaBlock *block = arena->head;
+    while (block != NULL)
+    {
+        ArenaBlock *next = block->next;
+        arena->f(block, arena->d);
+        block = next;
+    } // while
+    arena->head = NULL;
+} // arena_destroy
+
+
+// Threads...
+
+#if defined(MOJOSHADER_NO_THREADS)
+#define MOJOSHADER_THREAD_NONE 1
+#elif defined(MOJOSHADER_USE_SDL_STDLIB)
+#define MOJOSHADER_THREAD_SDL 1
+#ifdef USE_SDL3 /* Private define, for now */
+#include <SDL3/SDL_atomic.h>
+#include <SDL3/SDL_cpuinfo.h>
+#include <SDL3/SDL_mutex.h>
+#include <SDL3/SDL_thread.h>
+typedef SDL_Mutex SDL_mutex;
+#else
+#include <SDL_atomic.h>
+#include <SDL_cpuinfo.h>
+#include <SDL_mutex.h>
+#include <SDL_thread.h>
+#endif
+#elif defined(_WIN32)
+#define MOJOSHADER_THREAD_WIN32 1
+#define WIN32_LEAN_AND_MEAN 1
+#include <windows.h>
+#else
+#define MOJOSHADER_THREAD_PTHREAD 1
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+// atomic_add() uses this directly, even in SDL builds.
+#if defined(_MSC_VER) && !MOJOSHADER_THREAD_NONE
+#include <intrin.h>
+#pragma intrinsic(_InterlockedExchangeAdd)
+#endif
+
+struct Thread
+{
+    ThreadFn fn;
+    void *data;
+    int retval;
+#if MOJOSHADER_THREAD_SDL
+    SDL_Thread *thread;
+#elif MOJOSHADER_THREAD_WIN32
+    HANDLE thread;
+#elif MOJOSHADER_THREAD_PTHREAD
+    pthread_t thread;
+#endif
+    MOJOSHADER_free f;
+    void *d;
+};
+
+struct Mutex
+{
+#if MOJOSHADER_THREAD_SDL
+    SDL_mutex *mutex;
+#elif MOJOSHADER_THREAD_WIN32
+    CRITICAL_SECTION mutex;
+#elif MOJOSHADER_THREAD_PTHREAD
+    pthread_mutex_t mutex;
+#endif
+    MOJOSHADER_free f;
+    void *d;
+};
+
+#if MOJOSHADER_THREAD_SDL
+static int SDLCALL thread_entry(void *_thread)
+{
+    Thread *thread = (Thread *) _thread;
+    thread->retval = thread->fn(thread->data);
+    return 0;
+} // thread_entry
+#elif MOJOSHADER_THREAD_WIN32
+static DWORD WINAPI thread_entry(LPVOID _thread)
+{
+    Thread *thread = (Thread *) _thread;
+    thread->retval = thread->fn(thread->data);
+    return 0;
+} // thread_entry
+#elif MOJOSHADER_THREAD_PTHREAD
+static void *thread_entry(void *_thread)
+{
+    Thread *thread = (Thread *) _thread;
+    thread->retval = thread->fn(thread->data);
+    return NULL;
+} // thread_entry
+#endif
+
+Thread *thread_create(ThreadFn fn, void *data,
+                      MOJOSHADER_malloc m, MOJOSHADER_free f, void *d)
+{
+#if MOJOSHADER_THREAD_NONE
+    return NULL;
+#else
+    if (m == NULL) m = MOJOSHADER_internal_malloc;
+    if (f == NULL) f = MOJOSHADER_internal_free;
+
+    Thread *retval = (Thread *) m(sizeof (Thread), d);
+    if (retval == NULL)
+        return NULL;
+
+    memset(retval, '\0', sizeof (Thread));
+    retval->fn = fn;
+    retval->data = data;
+    retval->f = f;
+    retval->d = d;
+
+#if MOJOSHADER_THREAD_SDL
+    retval->thread = SDL_CreateThread(thread_entry, "mojoshader", retval);
+    if (retval->thread == NULL)
+#elif MOJOSHADER_THREAD_WIN32
+    retval->thread = CreateThread(NULL, 0, thread_entry, retval, 0, NULL);
+    if (retval->thread == NULL)
+#elif MOJOSHADER_THREAD_PTHREAD
+    if (pthread_create(&retval->thread, NULL, thread_entry, retval) != 0)
+#endif
+    {
+        f(retval, d);
+        return NULL;
+    } // if
+
+    return retval;
+#endif
+} // thread_create
+
+int thread_wait(Thread *thread)
+{
+    int retval = 0;
+    if (thread == NULL)
+        return 0;
+
+#if MOJOSHADER_THREAD_SDL
+    SDL_WaitThread(thread->thread, NULL);
+#elif MOJOSHADER_THREAD_WIN32
+    WaitForSingleObject(thread->thread, INFINITE);
+    CloseHandle(thread->thread);
+#elif MOJOSHADER_THREAD_PTHREAD
+    pthread_join(thread->thread, NULL);
+#endif
+
+    retval = thread->retval;
+    thread->f(thread, thread->d);
+    return retval;
+} // thread_wait
+
+Mutex *mutex_create(MOJOSHADER_malloc m, MOJOSHADER_free f, void *d)
+{
+#if MOJOSHADER_THREAD_NONE
+    return NULL;
+#else
+    if (m == NULL) m = MOJOSHADER_internal_malloc;
+    if (f == NULL) f = MOJOSHADER_internal_free;
+
+    Mutex *retval = (Mutex *) m(sizeof (Mutex), d);
+    if (retval == NULL)
+        return NULL;
+
+    retval->f = f;
+    retval->d = d;
+
+#if MOJOSHADER_THREAD_SDL
+    retval->mutex = SDL_CreateMutex();
+    if (retval->mutex == NULL)
+    {
+        f(retval, d);
+        return NULL;
+    } // if
+#elif MOJOSHADER_THREAD_WIN32
+    InitializeCriticalSection(&retval->mutex);
+#elif MOJOSHADER_THREAD_PTHREAD
+    if (pthread_mutex_init(&retval->mutex, NULL) != 0)
+    {
+        f(retval, d);
+        return NULL;
+    } // if
+#endif
+
+    return retval;
+#endif
+} // mutex_create
+
+void mutex_lock(Mutex *mutex)
+{
+    if (mutex == NULL)
+        return;
+#if MOJOSHADER_THREAD_SDL
+    SDL_LockMutex(mutex->mutex);
+#elif MOJOSHADER_THREAD_WIN32
+    EnterCriticalSection(&mutex->mutex);
+#elif MOJOSHADER_THREAD_PTHREAD
+    pthread_mutex_lock(&mutex->mutex);
+#endif
+} // mutex_lock
+
+void mutex_unlock(Mutex *mutex)
+{
+    if (mutex == NULL)
+        return;
+#if MOJOSHADER_THREAD_SDL
+    SDL_UnlockMutex(mutex->mutex);
+#elif MOJOSHADER_THREAD_WIN32
+    LeaveCriticalSection(&mutex->mutex);
+#elif MOJOSHADER_THREAD_PTHREAD
+    pthread_mutex_unlock(&mutex->mutex);
+#endif
+} // mutex_unlock
+
+void mutex_destroy(Mutex *mutex)
+{
+    if (mutex == NULL)
+        return;
+#if MOJOSHADER_THREAD_SDL
+    SDL_DestroyMutex(mutex->mutex);
+#elif MOJOSHADER_THREAD_WIN32
+    DeleteCriticalSection(&mutex->mutex);
+#elif MOJOSHADER_THREAD_PTHREAD
+    pthread_mutex_destroy(&mutex->mutex);
+#endif
+    mutex->f(mutex, mutex->d);
+} // mutex_destroy
+
+int atomic_add(volatile int *value, const int amount)
+{
+#if MOJOSHADER_THREAD_NONE
+    const int retval = *value;
+    *value += amount;
+    return retval;
+#elif defined(_MSC_VER)
+    return (int) _InterlockedExchangeAdd((volatile long *) value, amount);
+#elif defined(__GNUC__)
+    return __sync_fetch_and_add(value, amount);
+#elif MOJOSHADER_THREAD_SDL && defined(USE_SDL3)
+    return SDL_AddAtomicInt((SDL_AtomicInt *) value, amount);
+#elif MOJOSHADER_THREAD_SDL
+    return SDL_AtomicAdd((SDL_atomic_t *) value, amount);
+#else
+    #error Please define atomic_add() for your platform, or MOJOSHADER_NO_THREADS.
+#endif
+} // atomic_add
+
+int cpu_count(void)
+{
+    int retval = 1;
+#if MOJOSHADER_THREAD_SDL && defined(USE_SDL3)
+    retval = SDL_GetNumLogicalCPUCores();
+#elif MOJOSHADER_THREAD_SDL
+    retval = SDL_GetCPUCount();
+#elif MOJOSHADER_THREAD_WIN32
+    SYSTEM_INFO info;
+    GetSystemInfo(&info);
+    retval = (int) info.dwNumberOfProcessors;
+#elif MOJOSHADER_THREAD_PTHREAD && defined(_SC_NPROCESSORS_ONLN)
+    retval = (int) sysconf(_SC_NPROCESSORS_ONLN);
+#endif
+    return (retval < 1) ? 1 : retval;
+} // cpu_count
+
+
 // Based on SDL_string.c's SDL_PrintFloat function
 size_t MOJOSHADER_printFloat(char *text, size_t maxlen, float arg)
 {
@@ -4403,7 +4403,7 @@ static void parse_source(Context *ctx, const char *filename,
     if (!include_close) include_close = MOJOSHADER_internal_include_close;
 
     pp = preprocessor_start(filename, source, sourcelen, include_open,
-                            include_close, defines, define_count, 0,
+                            include_close, NULL, defines, define_count, 0,
                             MallocBridge, FreeBridge, ctx);
     if (pp == NULL)
     {
@@ -16,6 +16,8 @@
 #include <math.h>
 #endif /* MOJOSHADER_USE_SDL_STDLIB */
 
+#include "mojoshader_preshader.h"
+
 void MOJOSHADER_runPreshader(const MOJOSHADER_preshader *preshader,
                              float *outregs)
 {
@@ -210,6 +212,300 @@ void MOJOSHADER_runPreshader(const MOJOSHADER_preshader *preshader,
     } // for
 } // MOJOSHADER_runPreshader
 
+
+/* Preshader programs...
+ * MOJOSHADER_runPreshader() works out every operand's type, width and
+ * location on every run. Effects run the same preshaders over and over, so
+ * they lower each one first: literal, temp and input operands become plain
+ * pointers, and only outputs (whose base changes per run) and array lookups
+ * are left to do at runtime. Math is done in floats, like the registers it
+ * ends up in, unless MOJOSHADER_PRESHADER_DOUBLE is defined.
+ */
+
+typedef enum PreshaderRefType
+{
+    PRESHADER_REF_FIXED,   // (ptr) is a literal, temp or input
+    PRESHADER_REF_OUTPUT,  // the run's output registers, plus (index)
+    PRESHADER_REF_ARRAY    // an input used to index (array)
+} PreshaderRefType;
+
+typedef struct PreshaderRef
+{
+    uint32 type;
+    uint32 width;  // elements read; scalar operands only read one
+    uint32 index;
+    const preshader_real *ptr;
+    const MOJOSHADER_preshaderOperand *array;
+} PreshaderRef;
+
+typedef struct PreshaderOp
+{
+    uint32 opcode;
+    uint32 elems;
+    uint32 src_count;
+    PreshaderRef src[3];
+    preshader_real *temp_dst;  // NULL to store to output register (dst_index)
+    uint32 dst_index;
+} PreshaderOp;
+
+/* A preshader lowered into a form that's quicker to run */
+typedef struct MOJOSHADER_preshaderProgram
+{
+    uint32 op_count;
+    PreshaderOp *ops;
+    const float *inregs;
+    uint32 input_count;
+    preshader_real *inputs;  // inregs as reals, or inregs itself
+    preshader_real *literals;
+    uint32 temp_count;
+    preshader_real *temps;
+} MOJOSHADER_preshaderProgram;
+
+static void freepreshaderprogram(MOJOSHADER_preshaderProgram *program,
+                                 MOJOSHADER_free f, void *d)
+{
+    if (program != NULL)
+    {
+        f(program->ops, d);
+        f(program->literals, d);
+        f(program->temps, d);
+#ifdef MOJOSHADER_PRESHADER_DOUBLE
+        f(program->inputs, d);
+#endif
+        f(program, d);
+    } // if
+} // freepreshaderprogram
+
+static MOJOSHADER_preshaderProgram *compilepreshader(const MOJOSHADER_preshader *preshader,
+                                                     MOJOSHADER_malloc m,
+                                                     MOJOSHADER_free f,
+                                                     void *d)
+{
+    const int scalarstart = (int) MOJOSHADER_PRESHADEROP_SCALAR_OPS;
+    MOJOSHADER_preshaderProgram *program;
+    uint32 i, j, siz;
+
+    program = (MOJOSHADER_preshaderProgram *) m(sizeof (MOJOSHADER_preshaderProgram), d);
+    if (program == NULL)
+        return NULL;
+    memset(program, '\0', sizeof (MOJOSHADER_preshaderProgram));
+
+    program->op_count = preshader->instruction_count;
+    siz = sizeof (PreshaderOp) * program->op_count;
+    program->ops = (PreshaderOp *) m(siz, d);
+    if (program->ops == NULL)
+        goto compilepreshader_failed;
+    memset(program->ops, '\0', siz);
+
+    if (preshader->literal_count > 0)
+    {
+        program->literals = (preshader_real *) m(sizeof (preshader_real) * preshader->literal_count, d);
+        if (program->literals == NULL)
+            goto compilepreshader_failed;
+        for (i = 0; i < preshader->literal_count; i++)
+            program->literals[i] = (preshader_real) preshader->literals[i];
+    } // if
+
+    if (preshader->temp_count > 0)
+    {
+        program->temp_count = preshader->temp_count;
+        siz = sizeof (preshader_real) * program->temp_count;
+        program->temps = (preshader_real *) m(siz, d);
+        if (program->temps == NULL)
+            goto compilepreshader_failed;
+        memset(program->temps, '\0', siz);
+    } // if
+
+    program->inregs = preshader->registers;
+    program->input_count = preshader->register_count * 4;
+#ifdef MOJOSHADER_PRESHADER_DOUBLE
+    if (program->input_count > 0)
+    {
+        program->inputs = (preshader_real *) m(sizeof (preshader_real) * program->input_count, d);
+        if (program->inputs == NULL)
+            goto compilepreshader_failed;
+    } // if
+#else
+    program->inputs = preshader->registers;
+#endif
+
+    for (i = 0; i < program->op_count; i++)
+    {
+        const MOJOSHADER_preshaderInstruction *inst = &preshader->instructions[i];
+        const MOJOSHADER_preshaderOperand *operand = inst->operands;
+        const int isscalarop = (inst->opcode >= scalarstart);
+        PreshaderOp *op = &program->ops[i];
+
+        switch (inst->opcode)
+        {
+            // These just assert in MOJOSHADER_runPreshader, leave them to it.
+            case MOJOSHADER_PRESHADEROP_NOP:
+            case MOJOSHADER_PRESHADEROP_MOVC:
+            case MOJOSHADER_PRESHADEROP_NOISE:
+            case MOJOSHADER_PRESHADEROP_DOT_SCALAR:
+            case MOJOSHADER_PRESHADEROP_NOISE_SCALAR:
+                goto compilepreshader_failed;
+            default:
+                break;
+        } // switch
+
+        if ((inst->operand_count < 1) || (inst->operand_count > 4)
+         || (inst->element_count > 4))
+            goto compilepreshader_failed;
+
+        op->opcode = (uint8) inst->opcode;
+        op->elems = (uint8) inst->element_count;
+        op->src_count = (uint8) (inst->operand_count - 1);
+
+        for (j = 0; j < op->src_count; j++, operand++)
+        {
+            PreshaderRef *ref = &op->src[j];
+            const int isscalar = ((isscalarop) && (j == 0));
+            ref->type = PRESHADER_REF_FIXED;
+            ref->width = isscalar ? 1 : op->elems;
+            ref->index = operand->index;
+            switch (operand->type)
+            {
+                case MOJOSHADER_PRESHADEROPERAND_LITERAL:
+                    if ((operand->index + ref->width) > preshader->literal_count)
+                        goto compilepreshader_failed;
+                    ref->ptr = program->literals + operand->index;
+                    break;
+
+                case MOJOSHADER_PRESHADEROPERAND_INPUT:
+                    if (operand->array_register_count > 0)
+                    {
+                        ref->type = PRESHADER_REF_ARRAY;
+                        ref->width = 1;
+                        ref->array = operand;
+                    } // if
+                    else if ((operand->index + ref->width) > program->input_count)
+                        goto compilepreshader_failed;
+                    else
+                        ref->ptr = program->inputs + operand->index;
+                    break;
+
+                case MOJOSHADER_PRESHADEROPERAND_OUTPUT:
+                    ref->type = PRESHADER_REF_OUTPUT;
+                    break;
+
+                case MOJOSHADER_PRESHADEROPERAND_TEMP:
+                    if ((operand->index + ref->width) > preshader->temp_count)
+                        goto compilepreshader_failed;
+                    ref->ptr = program->temps + operand->index;
+                    break;
+
+                default:
+                    goto compilepreshader_failed;
+            } // switch
+        } // for
+
+        // The last operand is the destination.
+        if (operand->type == MOJOSHADER_PRESHADEROPERAND_TEMP)
+        {
+            if ((operand->index + op->elems) > preshader->temp_count)
+                goto compilepreshader_failed;
+            op->temp_dst = program->temps + operand->index;
+        } // if
+        else if (operand->type == MOJOSHADER_PRESHADEROPERAND_OUTPUT)
+            op->dst_index = operand->index;
+        else
+            goto compilepreshader_failed;
+    } // for
+
+    return program;
+
+compilepreshader_failed:
+    freepreshaderprogram(program, f, d);
+    return NULL;
+} // compilepreshader
+
+static inline const preshader_real *preshader_source(const MOJOSHADER_preshaderProgram *program,
+                                                     const PreshaderRef *ref,
+                                                     const float *outregs,
+                                                     preshader_real *scratch)
+{
+    if (ref->type == PRESHADER_REF_FIXED)
+        return ref->ptr;
+    else if (ref->type == PRESHADER_REF_OUTPUT)
+    {
+        // MOJOSHADER_runPreshader reads output operands from (outregs) too;
+        //  it's only testparse's disassembly that prints them like temps.
+#ifdef MOJOSHADER_PRESHADER_DOUBLE
+        // Outputs are always float; widen them into (scratch).
+        uint32 i;
+        for (i = 0; i < ref->width; i++)
+            scratch[i] = outregs[ref->index + i];
+        return scratch;
+#else
+        return outregs + ref->index;
+#endif
+    } // else if
+    else
+    {
+        const int *regsi = (const int *) program->inregs;
+        const unsigned int index = ref->index;
+        unsigned int k;
+        int arrIndex = regsi[((index >> 4) * 4) + ((index >> 2) & 3)];
+        for (k = 0; k < ref->array->array_register_count; k++)
+            arrIndex = regsi[ref->array->array_registers[k] + arrIndex];
+        // Only element 0 is looked up, but the op may read all (elems) of
+        //  it. MOJOSHADER_runPreshader() leaves the rest of its src[] slot
+        //  as the previous instruction left it, which has nothing to do
+        //  with this operand; here they read as zero instead. So a wide op
+        //  on an array operand can differ from it in elements 1..3, where
+        //  the result was garbage anyhow.
+        scratch[0] = (preshader_real) arrIndex;
+        scratch[1] = scratch[2] = scratch[3] = 0.0f;
+        return scratch;
+    } // else
+} // preshader_source
+
+static void runpreshaderprogram(const MOJOSHADER_preshaderProgram *program,
+                                float *outregs)
+{
+    const PreshaderOp *op = program->ops;
+    const PreshaderOp *end = op + program->op_count;
+    preshader_real scratch[3][4];
+    preshader_real dst[4];
+    int i;
+
+#ifdef MOJOSHADER_PRESHADER_DOUBLE
+    for (i = 0; i < (int) program->input_count; i++)
+        program->inputs[i] = program->inregs[i];
+#endif
+
+    // Temps start at zero every run, same as MOJOSHADER_runPreshader.
+    if (program->temp_count > 0)
+        memset(program->temps, '\0', sizeof (preshader_real) * program->temp_count);
+
+    for (; op != end; op++)
+    {
+        const int elems = op->elems;
+        // Sources are read straight from their registers; (dst) is only
+        // stored once they're all read, so overlapping is fine.
+        const preshader_real *src0 = preshader_source(program, &op->src[0], outregs, scratch[0]);
+        const preshader_real *src1 = (op->src_count > 1) ? preshader_source(program, &op->src[1], outregs, scratch[1]) : NULL;
+        const preshader_real *src2 = (op->src_count > 2) ? preshader_source(program, &op->src[2], outregs, scratch[2]) : NULL;
+
+#ifdef PRESHADER_SIMD
+        if ((elems != 4) || !runpreshaderop4(op->opcode, src0, src1, src2, dst))
+#endif
+        runpreshaderop(op->opcode, elems, src0, src1, src2, dst);
+
+        if (op->temp_dst != NULL)
+        {
+            for (i = 0; i < elems; i++)
+                op->temp_dst[i] = dst[i];
+        } // if
+        else
+        {
+            for (i = 0; i < elems; i++)
+                outregs[op->dst_index + i] = (float) dst[i];
+        } // else
+    } // for
+} // runpreshaderprogram
+
 static MOJOSHADER_effect MOJOSHADER_out_of_mem_effect = {
     1, &MOJOSHADER_out_of_mem_error, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0
 };
@@ -266,51 +562,361 @@ static uint32 readui32(const uint8 **_ptr, uint32 *_len)
     return retval;
 } // readui32
 
+/* Reads the count for a table of (entrysize)-byte entries. If the table
+ * can't possibly fit in what's left, this runs the reader out of data (so
+ * the caller reports an unexpected EOF) rather than allocating for it.
+ */
+static uint32 readcount(const uint8 **_ptr, uint32 *_len, const uint32 entrysize)
+{
+    const uint32 retval = readui32(_ptr, _len);
+    if (retval > (*_len / entrysize))
+    {
+        *_len = 0;
+        return 0;
+    } // if
+    return retval;
+} // readcount
+
 static char *readstring(const uint8 *base,
+                        const uint32 baselen,
                         const uint32 offset,
                         MOJOSHADER_malloc m,
                         void *d)
 {
-    // !!! FIXME: sanity checks!
-    // !!! FIXME: verify this doesn't go past EOF looking for a null.
-    uint8 *pair = (uint8 *) (base + offset);
-    const uint32 *lenptr = (const uint32 *) pair;
-    char *strptr = (char *) (pair + sizeof(uint32));
-
-    const uint32 len = SWAP32(*lenptr);
+    const uint8 *ptr = base + offset;
+    uint32 len = (offset < baselen) ? baselen - offset : 0;
+    const uint32 siz = readui32(&ptr, &len);
     char *result = NULL;
 
-    if (len == 0) return NULL; /* No length? No string. */
+    if (siz == 0) return NULL; /* No length? No string. */
+    if (siz > len) return NULL; /* Runs off the end? No string, either. */
 
-    result = (char *) m(len, d);
-    memcpy(result, strptr, len);
+    result = (char *) m(siz, d);
+    if (result == NULL) return NULL;
+    memcpy(result, ptr, siz);
+    result[siz - 1] = '\0'; /* The length includes the null, or it should. */
     return result;
 } // readstring
 
-static int findparameter(const MOJOSHADER_effectParam *params,
-                         const uint32 param_count,
-                         const char *name)
+/* How compileeffect() deals with shader objects */
+typedef enum
+{
+    SHADERLOAD_EAGER,   // compile everything while parsing
+    SHADERLOAD_MAPPED,  // compile on first use, from the app's buffer
+    SHADERLOAD_COPIED,  // compile on first use, from our own copy
+    SHADERLOAD_PARALLEL // translate them all at once, after parsing
+} ShaderLoad;
+
+/* What MOJOSHADER_compileEffectThreaded() needs beyond the usual arguments */
+typedef struct ParallelCompile
+{
+    const char *profile;
+    MOJOSHADER_compileParsedShaderFunc compileParsedShader;
+    unsigned int threadcount;
+} ParallelCompile;
+
+/* A lazy effect's shader object, compiled the first time it's used and
+ * then shared by the effect and its clones.
+ */
+typedef struct LazyShader
+{
+    const uint8 *tokenbuf;  // NULL if the object isn't a shader
+    uint32 bufsize;
+    int failed;  // so a broken shader isn't compiled again on every pass
+    int queued;  // already in the prewarm queue, or was once
+    MOJOSHADER_effectShader shader;  // holds a reference, owns the params
+} LazyShader;
+
+/* Everything that can't change after parsing (errors, techniques,
+ * parameter names, types and annotations, preshader code...) is shared
+ * between an effect and its clones; this counts its owners and holds the
+ * parameter name hash, plus the shaders a lazy effect compiled on first
+ * use. The last effect deleted frees it all.
+ */
+typedef struct MOJOSHADER_effectShared
+{
+    volatile int refcount;  // the effect that parsed it, plus its clones
+    HashTable *param_hash;  // parameter name -> index into params
+
+    // For lazy effects, one per object, else NULL. See loadshader().
+    LazyShader *lazy;
+    uint32 object_count;
+
+    // Clones can load shaders and prewarm on different threads, so this
+    //  guards (lazy) and the prewarm queue. NULL without threads.
+    Mutex *lock;
+    int owns_tokens;  // tokenbufs are our copies, not the app's buffer
+
+    // Object indices for MOJOSHADER_effectPrewarmStep(). Each object is
+    //  only ever queued once, so this never needs more than object_count.
+    uint32 *prewarm;
+    uint32 prewarm_head;
+    uint32 prewarm_tail;
+    MOJOSHADER_swizzle *swiz;
+    uint32 swizcount;
+    MOJOSHADER_samplerMap *smap;
+    uint32 smapcount;
+
+    MOJOSHADER_free f;
+    void *d;
+} MOJOSHADER_effectShared;
+
+/* What a pass binds, worked out once when the effect is compiled, so
+ * beginning a pass doesn't have to search its states.
+ */
+typedef struct PassPlan
+{
+    // NULL if the pass leaves that stage alone.
+    MOJOSHADER_effectShader *vertex;
+    MOJOSHADER_effectShader *pixel;
+    int has_preshader;  // either one picks its shader with a preshader
+
+    // Lazy shaders fill these in when the pass first loads them.
+    const MOJOSHADER_samplerStateRegister *vertex_samplers;
+    uint32 vertex_sampler_count;
+    const MOJOSHADER_samplerStateRegister *pixel_samplers;
+    uint32 pixel_sampler_count;
+    int samplers_planned;
+} PassPlan;
+
+/* The last result of a shader object's preshader, so it only needs to run
+ * again after one of its input parameters is set.
+ */
+typedef struct PreshaderMemo
+{
+    MOJOSHADER_preshaderProgram *program;  // NULL if it couldn't be lowered
+    int valid;  // (versions) holds the inputs of a finished run
+
+    // The version of each input parameter at the last run.
+    uint32 input_count;
+    uint32 *versions;
+
+    float selector;  // for shader arrays, the index the selector picked
+
+    // For constant preshaders, the register file floats the last run wrote.
+    uint32 output_count;
+    uint32 *output_index;
+    float *outputs;
+
+    // Holds (versions) and the outputs if the shader was loaded on first
+    //  use, rather than with the rest of the effect. Otherwise NULL.
+    void *storage;
+} PreshaderMemo;
+
+struct MOJOSHADER_effectRuntime
+{
+    MOJOSHADER_effectShared *shared;
+    PassPlan **pass_plans;  // by technique, then pass
+
+    // Nonzero if the app asked to only copy changed parameters, and the
+    //  shaders whose registers CommitChanges last filled in. If the shaders
+    //  differ from these, every parameter gets copied again.
+    int track_changes;
+    MOJOSHADER_effectShader *committed_vert_raw;
+    MOJOSHADER_effectShader *committed_pixl_raw;
+
+    // One memo per object, and how often CommitChanges could reuse one.
+    PreshaderMemo *preshader_memos;
+    uint32 preshader_hits;
+    uint32 preshader_misses;
+
+    // When tracking, one allocation: a version per parameter that goes up
+    //  every time the parameter is set, a flag per parameter set since the
+    //  last commit, and the list of flagged parameters, to clear them.
+    uint32 *param_versions;
+    uint8 *param_dirty;
+    uint32 *dirty_params;
+    uint32 dirty_count;
+};
+
+/* Sits in front of every top-level parameter's values, so the setters can
+ * find the effect that owns them. See homeparamvalues().
+ */
+typedef struct ParamValueHeader
+{
+    MOJOSHADER_effectRuntime *runtime;
+    uint32 index;
+} ParamValueHeader;
+
+static void paramhash_nuke(const void *ctx, const void *key,
+                           const void *value, void *data) {/*no-op*/}
+
+// Returns non-zero if the caller held the last reference, and so owns
+//  everything the effect shares with its clones. See freeshared(). Clones
+//  can be deleted on different threads, so this has to be atomic.
+static int releaseshared(MOJOSHADER_effectShared *shared)
+{
+    if (shared == NULL)
+        return 1;  // never got far enough to share anything.
+    return (atomic_add(&shared->refcount, -1) == 1);
+} // releaseshared
+
+static void destroyshared(MOJOSHADER_effectShared *shared)
+{
+    MOJOSHADER_free f;
+    void *d;
+    uint32 i;
+
+    if (shared == NULL)
+        return;
+
+    f = shared->f;
+    d = shared->d;
+    if (shared->param_hash != NULL)
+        hash_destroy(shared->param_hash, NULL);
+    if (shared->lazy != NULL)
+    {
+        for (i = 0; i < shared->object_count; i++)
+        {
+            f((void *) shared->lazy[i].shader.params, d);
+            f((void *) shared->lazy[i].shader.preshader_params, d);
+            if (shared->owns_tokens)
+                f((void *) shared->lazy[i].tokenbuf, d);
+        } // for
+        f((void *) shared->lazy, d);
+    } // if
+    mutex_destroy(shared->lock);
+    f((void *) shared->prewarm, d);
+    f((void *) shared->swiz, d);
+    f((void *) shared->smap, d);
+    f(shared, d);
+} // destroyshared
+
+static MOJOSHADER_effectShared *buildshared(const MOJOSHADER_effectParam *params,
+                                            const int param_count,
+                                            MOJOSHADER_malloc m,
+                                            MOJOSHADER_free f,
+                                            void *d)
 {
+    MOJOSHADER_effectShared *retval;
     int i;
+
+    retval = (MOJOSHADER_effectShared *) m(sizeof (MOJOSHADER_effectShared), d);
+    if (retval == NULL)
+        return NULL;
+    memset(retval, '\0', sizeof (MOJOSHADER_effectShared));
+    retval->refcount = 1;
+    retval->f = f;
+    retval->d = d;
+
+    // The keys are the parameters' own names, which are shared, too.
+    retval->param_hash = hash_create(NULL, hash_hash_string,
+                                     hash_keymatch_string, paramhash_nuke,
+                                     0, m, f, d);
+    if (retval->param_hash == NULL)
+        goto buildshared_outOfMemory;
+
     for (i = 0; i < param_count; i++)
-        if (strcmp(name, params[i].value.name) == 0)
-            return i;
-    assert(0 && "Parameter not found!");
-    return -1;
-}
+    {
+        const char *name = params[i].value.name;
+        if (name == NULL)
+            continue;  // can't be looked up anyhow.
+        // On a duplicate name the first one wins, like the old linear search.
+        if (hash_insert(retval->param_hash, name, (const void *) (size_t) i) < 0)
+            goto buildshared_outOfMemory;
+    } // for
+
+    return retval;
+
+buildshared_outOfMemory:
+    destroyshared(retval);
+    return NULL;
+} // buildshared
+
+/* Lazy effects compile shaders later, so hold on to what that needs */
+static int buildlazyshaders(MOJOSHADER_effectShared *shared,
+                            const ShaderLoad load,
+                            const uint32 object_count,
+                            const MOJOSHADER_swizzle *swiz,
+                            const unsigned int swizcount,
+                            const MOJOSHADER_samplerMap *smap,
+                            const unsigned int smapcount,
+                            MOJOSHADER_malloc m,
+                            void *d)
+{
+    uint32 siz = sizeof (LazyShader) * object_count;
+    shared->lazy = (LazyShader *) m(siz, d);
+    if (shared->lazy == NULL)
+        return 0;
+    memset(shared->lazy, '\0', siz);
+    shared->object_count = object_count;
+    shared->owns_tokens = (load == SHADERLOAD_COPIED);
+
+    // These only need the table until compileeffect() is done with it.
+    if (load == SHADERLOAD_PARALLEL)
+        return 1;
+
+    #ifdef MOJOSHADER_NO_THREADS
+    const int need_mutex = 0;
+    #else
+    const int need_mutex = 1;
+    #endif
+    shared->lock = mutex_create(m, shared->f, d);
+    if ((need_mutex) && (shared->lock == NULL))
+        return 0;
+
+    if (object_count > 0)
+    {
+        shared->prewarm = (uint32 *) m(sizeof (uint32) * object_count, d);
+        if (shared->prewarm == NULL)
+            return 0;
+    } // if
+
+    if (swizcount > 0)
+    {
+        siz = sizeof (MOJOSHADER_swizzle) * swizcount;
+        shared->swiz = (MOJOSHADER_swizzle *) m(siz, d);
+        if (shared->swiz == NULL)
+            return 0;
+        memcpy(shared->swiz, swiz, siz);
+        shared->swizcount = swizcount;
+    } // if
+
+    // Sampler maps only hold an index and a type, no strings to copy.
+    if (smapcount > 0)
+    {
+        siz = sizeof (MOJOSHADER_samplerMap) * smapcount;
+        shared->smap = (MOJOSHADER_samplerMap *) m(siz, d);
+        if (shared->smap == NULL)
+            return 0;
+        memcpy(shared->smap, smap, siz);
+        shared->smapcount = smapcount;
+    } // if
+
+    return 1;
+} // buildlazyshaders
+
+static int paramindex(const MOJOSHADER_effect *effect, const char *name)
+{
+    const void *value = NULL;
+    if ((name == NULL) || (effect->runtime == NULL))
+        return -1;  // nameless, or one of the static error effects.
+    else if (!hash_find(effect->runtime->shared->param_hash, name, &value))
+        return -1;
+    return (int) (size_t) value;
+} // paramindex
+
+static inline int issamplertype(const uint32 type)
+{
+    return ((type >= MOJOSHADER_SYMTYPE_SAMPLER)
+         && (type <= MOJOSHADER_SYMTYPE_SAMPLERCUBE));
+} // issamplertype
 
 static void readvalue(const uint8 *base,
+                      const uint32 baselen,
                       const uint32 typeoffset,
                       const uint32 valoffset,
                       MOJOSHADER_effectValue *value,
                       MOJOSHADER_effectObject *objects,
+                      const uint32 numobjects,
                       MOJOSHADER_malloc m,
                       void *d)
 {
     int i, j, k;
     const uint8 *typeptr = base + typeoffset;
     const uint8 *valptr = base + valoffset;
-    unsigned int typelen = 9999999;  // !!! FIXME
+    uint32 typelen = (typeoffset < baselen) ? baselen - typeoffset : 0;
+    uint32 vallen = (valoffset < baselen) ? baselen - valoffset : 0;
     const uint32 type = readui32(&typeptr, &typelen);
     const uint32 valclass = readui32(&typeptr, &typelen);
     const uint32 name = readui32(&typeptr, &typelen);
@@ -319,8 +925,8 @@ static void readvalue(const uint8 *base,
 
     value->type.parameter_type = (MOJOSHADER_symbolType) type;
     value->type.parameter_class = (MOJOSHADER_symbolClass) valclass;
-    value->name = readstring(base, name, m, d);
-    value->semantic = readstring(base, semantic, m, d);
+    value->name = readstring(base, baselen, name, m, d);
+    value->semantic = readstring(base, baselen, semantic, m, d);
     value->type.elements = numelements;
 
     /* Class sanity check */
@@ -340,36 +946,45 @@ static void readvalue(const uint8 *base,
         value->type.columns = columncount;
         value->type.rows = rowcount;
 
+        /* Every row is padded out to four floats, don't overrun that or the
+         * data we were given.
+         */
+        const uint32 rowlen = columncount << 2;
+        const uint64 datalen = ((uint64) rowlen) * rowcount * ((numelements > 0) ? numelements : 1);
+        if ((columncount == 0) || (columncount > 4) || (rowcount > 4) || (datalen > vallen))
+            return;
+
         uint32 siz = 4 * rowcount;
         if (numelements > 0)
             siz *= numelements;
         value->value_count = siz;
         siz *= 4;
         value->values = m(siz, d);
+        if (value->values == NULL)
+        {
+            value->value_count = 0;
+            return;
+        } // if
         memset(value->values, '\0', siz);
         siz /= 16;
         for (i = 0; i < siz; i++)
-            memcpy(value->valuesF + (i << 2), valptr + ((columncount << 2) * i), columncount << 2);
+            memcpy(value->valuesF + (i << 2), valptr + (rowlen * i), rowlen);
     } // if
     else if (valclass == MOJOSHADER_SYMCLASS_OBJECT)
     {
         /* This class contains either samplers or "objects" */
         assert(type >= MOJOSHADER_SYMTYPE_STRING && type <= MOJOSHADER_SYMTYPE_VERTEXSHADER);
 
-        if (type == MOJOSHADER_SYMTYPE_SAMPLER
-         || type == MOJOSHADER_SYMTYPE_SAMPLER1D
-         || type == MOJOSHADER_SYMTYPE_SAMPLER2D
-         || type == MOJOSHADER_SYMTYPE_SAMPLER3D
-         || type == MOJOSHADER_SYMTYPE_SAMPLERCUBE)
+        if (issamplertype(type))
         {
-            unsigned int vallen = 9999999; // !!! FIXME
-            const uint32 numstates = readui32(&valptr, &vallen);
-
-            value->value_count = numstates;
+            const uint32 numstates = readcount(&valptr, &vallen, 16);
 
             const uint32 siz = sizeof(MOJOSHADER_effectSamplerState) * numstates;
             value->values = m(siz, d);
+            if (value->values == NULL)
+                return;
             memset(value->values, '\0', siz);
+            value->value_count = numstates;
 
             for (i = 0; i < numstates; i++)
             {
@@ -380,24 +995,29 @@ static void readvalue(const uint8 *base,
                 const uint32 statevaloffset = readui32(&valptr, &vallen);
 
                 state->type = (MOJOSHADER_samplerStateType) stype;
-                readvalue(base, statetypeoffset, statevaloffset,
-                          &state->value, objects,
+                readvalue(base, baselen, statetypeoffset, statevaloffset,
+                          &state->value, objects, numobjects,
                           m, d);
-                if (stype == MOJOSHADER_SAMP_TEXTURE)
+                if (stype == MOJOSHADER_SAMP_TEXTURE
+                 && state->value.value_count > 0
+                 && state->value.valuesI[0] < numobjects)
                     objects[state->value.valuesI[0]].type = (MOJOSHADER_symbolType) type;
             } // for
         } // if
         else
         {
-            uint32 numobjects = 1;
+            uint32 numobjs = 1;
             if (numelements > 0)
-                numobjects = numelements;
-
-            value->value_count = numobjects;
+                numobjs = numelements;
+            if (numobjs > (vallen / 4))
+                return;
 
-            const uint32 siz = 4 * numobjects;
+            const uint32 siz = 4 * numobjs;
             value->values = m(siz, d);
+            if (value->values == NULL)
+                return;
             memcpy(value->values, valptr, siz);
+            value->value_count = numobjs;
             #if MOJOSHADER_BIG_ENDIAN
             int valI;
             for (valI=0;valI < (value->value_count);valI++) {
@@ -405,18 +1025,25 @@ static void readvalue(const uint8 *base,
             }
             #endif
             for (i = 0; i < value->value_count; i++)
-                objects[value->valuesI[i]].type = (MOJOSHADER_symbolType) type;
+                if (value->valuesI[i] < numobjects)
+                    objects[value->valuesI[i]].type = (MOJOSHADER_symbolType) type;
         } // else
     } // else if
     else if (valclass == MOJOSHADER_SYMCLASS_STRUCT)
     {
         uint32 siz;
 
-        value->type.member_count = readui32(&typeptr, &typelen);
-        siz = value->type.member_count * sizeof (MOJOSHADER_symbolStructMember);
+        const uint32 member_count = readcount(&typeptr, &typelen, 28);
+        siz = member_count * sizeof (MOJOSHADER_symbolStructMember);
         value->type.members = (MOJOSHADER_symbolStructMember *) m(siz, d);
+        if (value->type.members == NULL)
+            return;
+        memset(value->type.members, '\0', siz);
+        value->type.member_count = member_count;
 
-        uint32 structsize = 0;
+        int bogus = 0;
+        uint64 structsize = 0;
+        uint64 datalen = 0;
         for (i = 0; i < value->type.member_count; i++)
         {
             MOJOSHADER_symbolStructMember *mem = &value->type.members[i];
@@ -426,7 +1053,7 @@ static void readvalue(const uint8 *base,
 
             const uint32 memname = readui32(&typeptr, &typelen);
             /*const uint32 memsemantic =*/ readui32(&typeptr, &typelen);
-            mem->name = readstring(base, memname, m, d);
+            mem->name = readstring(base, baselen, memname, m, d);
 
             mem->info.elements = readui32(&typeptr, &typelen);
             mem->info.columns = readui32(&typeptr, &typelen);
@@ -440,20 +1067,39 @@ static void readvalue(const uint8 *base,
             mem->info.member_count = 0;
             mem->info.members = NULL;
 
-            uint32 memsize = 4 * mem->info.rows;
+            /* Same limits as above, the data comes right after the type */
+            if ((mem->info.columns == 0) || (mem->info.columns > 4) || (mem->info.rows > 4))
+            {
+                bogus = 1;
+                continue;
+            } // if
+            datalen += ((uint64) mem->info.rows) * mem->info.elements * (mem->info.columns << 2);
+            if (datalen > typelen)
+                bogus = 1;
+
+            uint64 memsize = 4 * mem->info.rows;
             if (mem->info.elements > 0)
                 memsize *= mem->info.elements;
             structsize += memsize;
         } // for
 
-        value->type.columns = structsize;
+        const uint32 numcopies = (numelements > 0) ? numelements : 1;
+        if (bogus || (datalen > (typelen / numcopies)) || (structsize > (0x3FFFFFFF / numcopies)))
+            return;
+
+        value->type.columns = (unsigned int) structsize;
         value->type.rows = 1;
-        value->value_count = structsize;
+        value->value_count = (unsigned int) structsize;
         if (numelements > 0)
             value->value_count *= numelements;
 
         siz = value->value_count * 4;
         value->values = m(siz, d);
+        if (value->values == NULL)
+        {
+            value->value_count = 0;
+            return;
+        } // if
         memset(value->values, '\0', siz);
         int dst_offset = 0, src_offset = 0;
         i = 0;
@@ -477,10 +1123,12 @@ static void readvalue(const uint8 *base,
 
 static void readannotations(const uint32 numannos,
                             const uint8 *base,
+                            const uint32 baselen,
                             const uint8 **ptr,
                             uint32 *len,
                             MOJOSHADER_effectAnnotation **annotations,
                             MOJOSHADER_effectObject *objects,
+                            const uint32 numobjects,
                             MOJOSHADER_malloc m,
                             void *d)
 {
@@ -498,18 +1146,20 @@ static void readannotations(const uint32 numannos,
         const uint32 typeoffset = readui32(ptr, len);
         const uint32 valoffset = readui32(ptr, len);
 
-        readvalue(base, typeoffset, valoffset,
-                  anno, objects,
+        readvalue(base, baselen, typeoffset, valoffset,
+                  anno, objects, numobjects,
                   m, d);
     } // for
 } // readannotation
 
 static void readparameters(const uint32 numparams,
                            const uint8 *base,
+                           const uint32 baselen,
                            const uint8 **ptr,
                            uint32 *len,
                            MOJOSHADER_effectParam **params,
                            MOJOSHADER_effectObject *objects,
+                           const uint32 numobjects,
                            MOJOSHADER_malloc m,
                            void *d)
 {
@@ -527,25 +1177,27 @@ static void readparameters(const uint32 numparams,
         const uint32 typeoffset = readui32(ptr, len);
         const uint32 valoffset = readui32(ptr, len);
         /*const uint32 flags =*/ readui32(ptr, len);
-        const uint32 numannos = readui32(ptr, len);
+        const uint32 numannos = readcount(ptr, len, 8);
 
         param->annotation_count = numannos;
-        readannotations(numannos, base, ptr, len,
-                        &param->annotations, objects,
+        readannotations(numannos, base, baselen, ptr, len,
+                        &param->annotations, objects, numobjects,
                         m, d);
 
-        readvalue(base, typeoffset, valoffset,
-                  &param->value, objects,
+        readvalue(base, baselen, typeoffset, valoffset,
+                  &param->value, objects, numobjects,
                   m, d);
     } // for
 } // readparameters
 
 static void readstates(const uint32 numstates,
                        const uint8 *base,
+                       const uint32 baselen,
                        const uint8 **ptr,
                        uint32 *len,
                        MOJOSHADER_effectState **states,
                        MOJOSHADER_effectObject *objects,
+                       const uint32 numobjects,
                        MOJOSHADER_malloc m,
                        void *d)
 {
@@ -566,18 +1218,20 @@ static void readstates(const uint32 numstates,
         const uint32 valoffset = readui32(ptr, len);
 
         state->type = (MOJOSHADER_renderStateType) type;
-        readvalue(base, typeoffset, valoffset,
-                  &state->value, objects,
+        readvalue(base, baselen, typeoffset, valoffset,
+                  &state->value, objects, numobjects,
                   m, d);
     } // for
 } // readstates
 
 static void readpasses(const uint32 numpasses,
                        const uint8 *base,
+                       const uint32 baselen,
                        const uint8 **ptr,
                        uint32 *len,
                        MOJOSHADER_effectPass **passes,
                        MOJOSHADER_effectObject *objects,
+                       const uint32 numobjects,
                        MOJOSHADER_malloc m,
                        void *d)
 {
@@ -593,29 +1247,31 @@ static void readpasses(const uint32 numpasses,
         MOJOSHADER_effectPass *pass = &(*passes)[i];
 
         const uint32 passnameoffset = readui32(ptr, len);
-        const uint32 numannos = readui32(ptr, len);
-        const uint32 numstates = readui32(ptr, len);
+        const uint32 numannos = readcount(ptr, len, 8);
+        const uint32 numstates = readcount(ptr, len, 16);
 
-        pass->name = readstring(base, passnameoffset, m, d);
+        pass->name = readstring(base, baselen, passnameoffset, m, d);
 
         pass->annotation_count = numannos;
-        readannotations(numannos, base, ptr, len,
-                        &pass->annotations, objects,
+        readannotations(numannos, base, baselen, ptr, len,
+                        &pass->annotations, objects, numobjects,
                         m, d);
 
         pass->state_count = numstates;
-        readstates(numstates, base, ptr, len,
-                   &pass->states, objects,
+        readstates(numstates, base, baselen, ptr, len,
+                   &pass->states, objects, numobjects,
                    m, d);
     } // for
 } // readpasses
 
 static void readtechniques(const uint32 numtechniques,
                            const uint8 *base,
+                           const uint32 baselen,
                            const uint8 **ptr,
                            uint32 *len,
                            MOJOSHADER_effectTechnique **techniques,
                            MOJOSHADER_effectObject *objects,
+                           const uint32 numobjects,
                            MOJOSHADER_malloc m,
                            void *d)
 {
@@ -631,45 +1287,235 @@ static void readtechniques(const uint32 numtechniques,
         MOJOSHADER_effectTechnique *technique = &(*techniques)[i];
 
         const uint32 nameoffset = readui32(ptr, len);
-        const uint32 numannos = readui32(ptr, len);
-        const uint32 numpasses = readui32(ptr, len);
+        const uint32 numannos = readcount(ptr, len, 8);
+        const uint32 numpasses = readcount(ptr, len, 12);
 
-        technique->name = readstring(base, nameoffset, m, d);
+        technique->name = readstring(base, baselen, nameoffset, m, d);
 
         technique->annotation_count = numannos;
-        readannotations(numannos, base, ptr, len,
-                        &technique->annotations, objects,
+        readannotations(numannos, base, baselen, ptr, len,
+                        &technique->annotations, objects, numobjects,
                         m, d);
 
         technique->pass_count = numpasses;
-        readpasses(numpasses, base, ptr, len,
-                   &technique->passes, objects,
+        readpasses(numpasses, base, baselen, ptr, len,
+                   &technique->passes, objects, numobjects,
                    m, d);
     } // for
 } // readtechniques
 
-static void readsmallobjects(const uint32 numsmallobjects,
-                             const uint8 **ptr,
-                             uint32 *len,
-                             MOJOSHADER_effect *effect,
-                             const MOJOSHADER_swizzle *swiz,
-                             const unsigned int swizcount,
-                             const MOJOSHADER_samplerMap *smap,
-                             const unsigned int smapcount,
-                             ErrorList *errors)
+/* Finds the parameters a compiled shader uses. (errors) may be NULL. */
+static int findshaderparams(MOJOSHADER_effect *effect,
+                            MOJOSHADER_effectShader *shader,
+                            ErrorList *errors)
 {
-    int i, j;
-    MOJOSHADER_parseData *pd;
+    int j;
     MOJOSHADER_malloc m = effect->ctx.m;
     void *d = effect->ctx.malloc_data;
+    const MOJOSHADER_parseData *pd = effect->ctx.getParseData(shader->shader);
 
-    if (numsmallobjects == 0) return;
+    if (pd->error_count > 0)
+    {
+        // Bail ASAP, so we can get the error to the application
+        if (errors != NULL)
+            push_errors(errors, pd->errors, pd->error_count);
+        return 0;
+    } // if
+
+    for (j = 0; j < pd->symbol_count; j++)
+        if (pd->symbols[j].register_set == MOJOSHADER_SYMREGSET_SAMPLER)
+            shader->sampler_count++;
+    shader->params = (uint32 *) m(pd->symbol_count * sizeof (uint32), d);
+    for (j = 0; j < pd->symbol_count; j++)
+    {
+        const int param = paramindex(effect, pd->symbols[j].name);
+        if (param < 0)
+            goto findshaderparams_missingParameter;
+        shader->params[j] = param;
+        shader->param_count++;
+    } // for
+    if (pd->preshader)
+    {
+        shader->preshader_params = (uint32 *) m(pd->preshader->symbol_count * sizeof (uint32), d);
+        for (j = 0; j < pd->preshader->symbol_count; j++)
+        {
+            const int param = paramindex(effect, pd->preshader->symbols[j].name);
+            if (param < 0)
+                goto findshaderparams_missingParameter;
+            shader->preshader_params[j] = param;
+            shader->preshader_param_count++;
+        } // for
+    } // if
+    return 1;
+
+findshaderparams_missingParameter:
+    if (errors != NULL)
+        errorlist_add(errors, NULL, 0, "Shader uses a parameter the effect doesn't have");
+    return 0;
+} // findshaderparams
+
+/* Compiles a shader object, and finds its parameters. (errors) may be NULL. */
+static int compileshaderobject(MOJOSHADER_effect *effect,
+                               MOJOSHADER_effectShader *shader,
+                               const uint32 index,
+                               const uint8 *tokenbuf,
+                               const uint32 length,
+                               const MOJOSHADER_swizzle *swiz,
+                               const unsigned int swizcount,
+                               const MOJOSHADER_samplerMap *smap,
+                               const unsigned int smapcount,
+                               ErrorList *errors)
+{
+    char mainfn[32];
+
+    snprintf(mainfn, sizeof (mainfn), "ShaderFunction%u", (unsigned int) index);
+    shader->shader = effect->ctx.compileShader(effect->ctx.shaderContext,
+                                               mainfn, tokenbuf, length,
+                                               swiz, swizcount,
+                                               smap, smapcount);
+    if (shader->shader == NULL)
+    {
+        // Bail ASAP, so we can get the error to the application
+        if (errors != NULL)
+            errorlist_add(errors, NULL, 0, effect->ctx.getError(effect->ctx.shaderContext));
+        return 0;
+    } // if
+    return findshaderparams(effect, shader, errors);
+} // compileshaderobject
+
+/* Samplers point at parameter values, so every effect builds its own */
+static int buildsamplers(MOJOSHADER_effect *effect,
+                         MOJOSHADER_effectShader *shader)
+{
+    int j;
+    uint32 curSampler = 0;
+    const MOJOSHADER_parseData *pd = effect->ctx.getParseData(shader->shader);
+    const uint32 siz = sizeof (MOJOSHADER_samplerStateRegister) * shader->sampler_count;
+
+    shader->samplers = (MOJOSHADER_samplerStateRegister *) effect->ctx.m(siz, effect->ctx.malloc_data);
+    if (shader->samplers == NULL)
+        return 0;
+    for (j = 0; j < pd->symbol_count; j++)
+        if (pd->symbols[j].register_set == MOJOSHADER_SYMREGSET_SAMPLER)
+        {
+            const MOJOSHADER_effectParam *param = &effect->params[shader->params[j]];
+            shader->samplers[curSampler].sampler_name = param->value.name;
+            shader->samplers[curSampler].sampler_register = pd->symbols[j].register_index;
+            shader->samplers[curSampler].sampler_state_count = param->value.value_count;
+            shader->samplers[curSampler].sampler_states = param->value.valuesSS;
+            curSampler++;
+        } // if
+    return 1;
+} // buildsamplers
+
+/* Compiles the shader now, or for lazy effects, remembers where it is */
+static int readshaderobject(MOJOSHADER_effect *effect,
+                            MOJOSHADER_effectShader *shader,
+                            const uint32 index,
+                            const uint8 *tokenbuf,
+                            const uint32 length,
+                            const MOJOSHADER_swizzle *swiz,
+                            const unsigned int swizcount,
+                            const MOJOSHADER_samplerMap *smap,
+                            const unsigned int smapcount,
+                            ErrorList *errors)
+{
+    MOJOSHADER_effectShared *shared = effect->runtime->shared;
+    LazyShader *lazy;
+
+    /* MOJOSHADER_parse() takes a zero size to mean "unknown", don't let it */
+    if (length == 0)
+        return 1;
+
+    if (shared->lazy != NULL)
+    {
+        lazy = &shared->lazy[index];
+        if (shared->owns_tokens)
+        {
+            uint8 *copy = (uint8 *) effect->ctx.m(length, effect->ctx.malloc_data);
+            if (copy == NULL)
+            {
+                errorlist_add(errors, NULL, 0, "Out of memory");
+                return 0;
+            } // if
+            memcpy(copy, tokenbuf, length);
+            tokenbuf = copy;
+        } // if
+        lazy->tokenbuf = tokenbuf;
+        lazy->bufsize = length;
+        lazy->shader.type = shader->type;
+        lazy->shader.technique = shader->technique;
+        lazy->shader.pass = shader->pass;
+        return 1;
+    } // if
+
+    if (!compileshaderobject(effect, shader, index, tokenbuf, length,
+                             swiz, swizcount, smap, smapcount, errors))
+        return 0;
+    if (!buildsamplers(effect, shader))
+    {
+        errorlist_add(errors, NULL, 0, "Out of memory");
+        return 0;
+    } // if
+    return 1;
+} // readshaderobject
+
+/* Nonzero if an earlier table entry already filled in this object */
+static int objectread(const MOJOSHADER_effect *effect, const uint32 index)
+{
+    const MOJOSHADER_effectShared *shared = effect->runtime->shared;
+    const MOJOSHADER_effectObject *object = &effect->objects[index];
+    if (object->type == MOJOSHADER_SYMTYPE_STRING)
+        return (object->string.string != NULL);
+    else if ((object->type >= MOJOSHADER_SYMTYPE_TEXTURE)
+          && (object->type <= MOJOSHADER_SYMTYPE_SAMPLERCUBE))
+        return (object->mapping.name != NULL);
+    else if (object->type == MOJOSHADER_SYMTYPE_PIXELSHADER
+          || object->type == MOJOSHADER_SYMTYPE_VERTEXSHADER)
+    {
+        if ((shared->lazy != NULL) && (shared->lazy[index].tokenbuf != NULL))
+            return 1;
+        return ((object->shader.shader != NULL) || (object->shader.params != NULL));
+    } // else if
+    return 0;
+} // objectread
+
+/* These return 0 if the object tables don't fit in the data, or make no
+ * sense. Shader errors are added to (errors), and still return 1.
+ */
+static int readsmallobjects(const uint32 numsmallobjects,
+                            const uint8 **ptr,
+                            uint32 *len,
+                            MOJOSHADER_effect *effect,
+                            const MOJOSHADER_swizzle *swiz,
+                            const unsigned int swizcount,
+                            const MOJOSHADER_samplerMap *smap,
+                            const unsigned int smapcount,
+                            ErrorList *errors)
+{
+    int i;
+    MOJOSHADER_malloc m = effect->ctx.m;
+    void *d = effect->ctx.malloc_data;
+
+    if (numsmallobjects == 0) return 1;
 
     for (i = 1; i < numsmallobjects + 1; i++)
     {
         const uint32 index = readui32(ptr, len);
         const uint32 length = readui32(ptr, len);
 
+        /* Object block is always a multiple of four */
+        const uint32 blocklen = (length + 3) - ((length - 1) % 4);
+        if ((index >= effect->object_count) || (length > *len) || (blocklen > *len))
+            return 0;
+        else if (objectread(effect, index))
+        {
+            // Listed twice? Keep the first one, rather than leak it.
+            *ptr += blocklen;
+            *len -= blocklen;
+            continue;
+        } // else if
+
         MOJOSHADER_effectObject *object = &effect->objects[index];
         if (object->type == MOJOSHADER_SYMTYPE_STRING)
         {
@@ -701,92 +1547,41 @@ static void readsmallobjects(const uint32 numsmallobjects,
         else if (object->type == MOJOSHADER_SYMTYPE_PIXELSHADER
               || object->type == MOJOSHADER_SYMTYPE_VERTEXSHADER)
         {
-            char mainfn[32];
-            snprintf(mainfn, sizeof(mainfn), "ShaderFunction%u", (unsigned int) index);
             object->shader.technique = -1;
             object->shader.pass = -1;
-            object->shader.shader = effect->ctx.compileShader(effect->ctx.shaderContext,
-                                                              mainfn, *ptr, length,
-                                                              swiz, swizcount,
-                                                              smap, smapcount);
-            if (object->shader.shader == NULL)
-            {
-                // Bail ASAP, so we can get the error to the application
-                errorlist_add(errors, NULL, 0, effect->ctx.getError(effect->ctx.shaderContext));
-                return;
-            } // if
-            pd = effect->ctx.getParseData(object->shader.shader);
-            if (pd->error_count > 0)
-            {
-                // Bail ASAP, so we can get the error to the application
-                push_errors(errors, pd->errors, pd->error_count);
-                return;
-            } // if
-
-            for (j = 0; j < pd->symbol_count; j++)
-                if (pd->symbols[j].register_set == MOJOSHADER_SYMREGSET_SAMPLER)
-                    object->shader.sampler_count++;
-            object->shader.param_count = pd->symbol_count;
-            object->shader.params = (uint32 *) m(object->shader.param_count * sizeof (uint32), d);
-            object->shader.samplers = (MOJOSHADER_samplerStateRegister *) m(object->shader.sampler_count * sizeof (MOJOSHADER_samplerStateRegister), d);
-            uint32 curSampler = 0;
-            for (j = 0; j < pd->symbol_count; j++)
-            {
-                int par = findparameter(effect->params,
-                                        effect->param_count,
-                                        pd->symbols[j].name);
-                object->shader.params[j] = par;
-                if (pd->symbols[j].register_set == MOJOSHADER_SYMREGSET_SAMPLER)
-                {
-                    object->shader.samplers[curSampler].sampler_name = effect->params[par].value.name;
-                    object->shader.samplers[curSampler].sampler_register = pd->symbols[j].register_index;
-                    object->shader.samplers[curSampler].sampler_state_count = effect->params[par].value.value_count;
-                    object->shader.samplers[curSampler].sampler_states = effect->params[par].value.valuesSS;
-                    curSampler++;
-                } // if
-            } // for
-            if (pd->preshader)
-            {
-                object->shader.preshader_param_count = pd->preshader->symbol_count;
-                object->shader.preshader_params = (uint32 *) m(object->shader.preshader_param_count * sizeof (uint32), d);
-                for (j = 0; j < pd->preshader->symbol_count; j++)
-                {
-                    object->shader.preshader_params[j] = findparameter(effect->params,
-                                                                       effect->param_count,
-                                                                       pd->preshader->symbols[j].name);
-                } // for
-            } // if
+            if (!readshaderobject(effect, &object->shader, index, *ptr, length,
+                                  swiz, swizcount, smap, smapcount, errors))
+                return 1;
         } // else if
         else
         {
             assert(0 && "Small object type unknown!");
         } // else
 
-        /* Object block is always a multiple of four */
-        const uint32 blocklen = (length + 3) - ((length - 1) % 4);
         *ptr += blocklen;
         *len -= blocklen;
     } // for
+    return 1;
 } // readstrings
 
-static void readlargeobjects(const uint32 numlargeobjects,
-                             const uint32 numsmallobjects,
-                             const uint8 **ptr,
-                             uint32 *len,
-                             MOJOSHADER_effect *effect,
-                             const MOJOSHADER_swizzle *swiz,
-                             const unsigned int swizcount,
-                             const MOJOSHADER_samplerMap *smap,
-                             const unsigned int smapcount,
-                             ErrorList *errors)
+static int readlargeobjects(const uint32 numlargeobjects,
+                            const uint32 numsmallobjects,
+                            const uint8 **ptr,
+                            uint32 *len,
+                            MOJOSHADER_effect *effect,
+                            const MOJOSHADER_swizzle *swiz,
+                            const unsigned int swizcount,
+                            const MOJOSHADER_samplerMap *smap,
+                            const unsigned int smapcount,
+                            ErrorList *errors)
 {
     int i, j;
-    MOJOSHADER_parseData *pd;
     MOJOSHADER_malloc m = effect->ctx.m;
     MOJOSHADER_free f = effect->ctx.f;
     void *d = effect->ctx.malloc_data;
+    const MOJOSHADER_effectValue *value;
 
-    if (numlargeobjects == 0) return;
+    if (numlargeobjects == 0) return 1;
 
     int numobjects = numsmallobjects + numlargeobjects + 1;
     for (i = numsmallobjects + 1; i < numobjects; i++)
@@ -798,11 +1593,37 @@ static void readlargeobjects(const uint32 numlargeobjects,
         const uint32 type = readui32(ptr, len);
         const uint32 length = readui32(ptr, len);
 
-        uint32 objectIndex;
+        /* Object block is always a multiple of four */
+        const uint32 blocklen = (length + 3) - ((length - 1) % 4);
+        if ((length > *len) || (blocklen > *len))
+            return 0;
+
+        value = NULL;
         if (technique == -1)
-            objectIndex = effect->params[index].value.valuesSS[state].value.valuesI[0];
-        else
-            objectIndex = effect->techniques[technique].passes[index].states[state].value.valuesI[0];
+        {
+            if ((index < effect->param_count)
+             && (effect->params[index].value.type.parameter_class == MOJOSHADER_SYMCLASS_OBJECT)
+             && issamplertype(effect->params[index].value.type.parameter_type)
+             && (state < effect->params[index].value.value_count))
+                value = &effect->params[index].value.valuesSS[state].value;
+        } // if
+        else if ((technique < effect->technique_count)
+              && (index < effect->techniques[technique].pass_count)
+              && (state < effect->techniques[technique].passes[index].state_count))
+            value = &effect->techniques[technique].passes[index].states[state].value;
+        if ((value == NULL) || (value->value_count == 0))
+            return 0;
+
+        const uint32 objectIndex = value->valuesI[0];
+        if (objectIndex >= effect->object_count)
+            return 0;
+        else if (objectread(effect, objectIndex))
+        {
+            // Listed twice? Keep the first one, rather than leak it.
+            *ptr += blocklen;
+            *len -= blocklen;
+            continue;
+        } // else if
 
         MOJOSHADER_effectObject *object = &effect->objects[objectIndex];
         if (object->type == MOJOSHADER_SYMTYPE_PIXELSHADER
@@ -818,82 +1639,37 @@ static void readlargeobjects(const uint32 numlargeobjects,
                  * vertex/fragment shader.
                  */
                 object->shader.is_preshader = 1;
-                const uint32 start = *((uint32 *) *ptr) + 4;
-                const char *array = readstring(*ptr, 0, m, d);
+                if (length < 4)
+                    return 0;
+                const uint32 namelen = SWAP32(*((uint32 *) *ptr));
+                if (namelen > (length - 4))
+                    return 0;
+                const uint32 start = namelen + 4;
+                const char *array = readstring(*ptr, length, 0, m, d);
+                const int arrayindex = paramindex(effect, array);
+                f((void *) array, d);
+                if (arrayindex < 0)
+                    return 0;
                 object->shader.param_count = 1;
                 object->shader.params = (uint32 *) m(sizeof (uint32), d);
-                object->shader.params[0] = findparameter(effect->params,
-                                                         effect->param_count,
-                                                         array);
-                f((void *) array, d);
-                object->shader.preshader = MOJOSHADER_parsePreshader(*ptr + start, length,
+                object->shader.params[0] = arrayindex;
+                object->shader.preshader = MOJOSHADER_parsePreshader(*ptr + start, length - start,
                                                                      m, f, d);
-                // !!! FIXME: check for errors.
-                object->shader.preshader_param_count = object->shader.preshader->symbol_count;
-                object->shader.preshader_params = (uint32 *) m(object->shader.preshader_param_count * sizeof (uint32), d);
+                if (object->shader.preshader == NULL)
+                    return 0;
+                object->shader.preshader_params = (uint32 *) m(object->shader.preshader->symbol_count * sizeof (uint32), d);
                 for (j = 0; j < object->shader.preshader->symbol_count; j++)
                 {
-                    object->shader.preshader_params[j] = findparameter(effect->params,
-                                                                       effect->param_count,
-                                                                       object->shader.preshader->symbols[j].name);
+                    const int param = paramindex(effect, object->shader.preshader->symbols[j].name);
+                    if (param < 0)
+                        return 0;
+                    object->shader.preshader_params[j] = param;
+                    object->shader.preshader_param_count++;
                 } // for
             } // if
-            else
-            {
-                char mainfn[32];
-                snprintf(mainfn, sizeof (mainfn), "ShaderFunction%u", (unsigned int) objectIndex);
-                object->shader.shader = effect->ctx.compileShader(effect->ctx.shaderContext,
-                                                                  mainfn, *ptr, length,
-                                                                  swiz, swizcount,
-                                                                  smap, smapcount);
-                if (object->shader.shader == NULL)
-                {
-                    // Bail ASAP, so we can get the error to the application
-                    errorlist_add(errors, NULL, 0, effect->ctx.getError(effect->ctx.shaderContext));
-                    return;
-                } // if
-                pd = effect->ctx.getParseData(object->shader.shader);
-                if (pd->error_count > 0)
-                {
-                    // Bail ASAP, so we can get the error to the application
-                    push_errors(errors, pd->errors, pd->error_count);
-                    return;
-                } // if
-
-                for (j = 0; j < pd->symbol_count; j++)
-                    if (pd->symbols[j].register_set == MOJOSHADER_SYMREGSET_SAMPLER)
-                        object->shader.sampler_count++;
-                object->shader.param_count = pd->symbol_count;
-                object->shader.params = (uint32 *) m(object->shader.param_count * sizeof (uint32), d);
-                object->shader.samplers = (MOJOSHADER_samplerStateRegister *) m(object->shader.sampler_count * sizeof (MOJOSHADER_samplerStateRegister), d);
-                uint32 curSampler = 0;
-                for (j = 0; j < pd->symbol_count; j++)
-                {
-                    int par = findparameter(effect->params,
-                                            effect->param_count,
-                                            pd->symbols[j].name);
-                    object->shader.params[j] = par;
-                    if (pd->symbols[j].register_set == MOJOSHADER_SYMREGSET_SAMPLER)
-                    {
-                        object->shader.samplers[curSampler].sampler_name = effect->params[par].value.name;
-                        object->shader.samplers[curSampler].sampler_register = pd->symbols[j].register_index;
-                        object->shader.samplers[curSampler].sampler_state_count = effect->params[par].value.value_count;
-                        object->shader.samplers[curSampler].sampler_states = effect->params[par].value.valuesSS;
-                        curSampler++;
-                    } // if
-                } // for
-                if (pd->preshader)
-                {
-                    object->shader.preshader_param_count = pd->preshader->symbol_count;
-                    object->shader.preshader_params = (uint32 *) m(object->shader.preshader_param_count * sizeof (uint32), d);
-                    for (j = 0; j < pd->preshader->symbol_count; j++)
-                    {
-                        object->shader.preshader_params[j] = findparameter(effect->params,
-                                                                           effect->param_count,
-                                                                           pd->preshader->symbols[j].name);
-                    } // for
-                } // if
-            }
+            else if (!readshaderobject(effect, &object->shader, objectIndex, *ptr, length,
+                                       swiz, swizcount, smap, smapcount, errors))
+                return 1;
         } // if
         else if (object->type == MOJOSHADER_SYMTYPE_TEXTURE
               || object->type == MOJOSHADER_SYMTYPE_TEXTURE1D
@@ -918,20 +1694,599 @@ static void readlargeobjects(const uint32 numlargeobjects,
             assert(0 && "Large object type unknown!");
         } // else
 
-        /* Object block is always a multiple of four */
-        const uint32 blocklen = (length + 3) - ((length - 1) % 4);
         *ptr += blocklen;
         *len -= blocklen;
     } // for
+    return 1;
 } // readobjects
 
-MOJOSHADER_effect *MOJOSHADER_compileEffect(const unsigned char *buf,
-                                            const unsigned int _len,
-                                            const MOJOSHADER_swizzle *swiz,
-                                            const unsigned int swizcount,
-                                            const MOJOSHADER_samplerMap *smap,
-                                            const unsigned int smapcount,
-                                            const MOJOSHADER_effectShaderContext *ctx)
+/* The shader object a VertexShader/PixelShader state sets, if it's sane */
+static MOJOSHADER_effectShader *stateshader(MOJOSHADER_effect *effect,
+                                            const MOJOSHADER_effectState *state)
+{
+    MOJOSHADER_effectObject *object;
+    if ((state->value.value_count == 0)
+     || (state->value.type.parameter_class != MOJOSHADER_SYMCLASS_OBJECT)
+     || (((uint32) state->value.valuesI[0]) >= effect->object_count))
+        return NULL;
+    object = &effect->objects[state->value.valuesI[0]];
+    if ((object->type != MOJOSHADER_SYMTYPE_PIXELSHADER)
+     && (object->type != MOJOSHADER_SYMTYPE_VERTEXSHADER))
+        return NULL;
+    return &object->shader;
+} // stateshader
+
+/* Fills in a plan's sampler states, once its shaders have been loaded */
+static void planpasssamplers(PassPlan *plan)
+{
+    const MOJOSHADER_effectShader *vert = plan->vertex;
+    const MOJOSHADER_effectShader *pixl = plan->pixel;
+
+    /* Preshaders pick their shader, and so their samplers, at commit time */
+    if (plan->has_preshader)
+        return;
+    else if ((vert != NULL) && (vert->shader == NULL))
+        return;
+    else if ((pixl != NULL) && (pixl->shader == NULL))
+        return;
+
+    if (vert != NULL)
+    {
+        plan->vertex_samplers = vert->samplers;
+        plan->vertex_sampler_count = vert->sampler_count;
+    } // if
+    if (pixl != NULL)
+    {
+        plan->pixel_samplers = pixl->samplers;
+        plan->pixel_sampler_count = pixl->sampler_count;
+    } // if
+    plan->samplers_planned = 1;
+} // planpasssamplers
+
+static int buildpassplans(MOJOSHADER_effect *effect)
+{
+    int i, j, k;
+    MOJOSHADER_malloc m = effect->ctx.m;
+    void *d = effect->ctx.malloc_data;
+    PassPlan **plans;
+    PassPlan *plan;
+    MOJOSHADER_effectShader *shader;
+    MOJOSHADER_effectState *state;
+    uint32 siz, numpasses = 0;
+
+    if (effect->technique_count == 0) return 1;
+
+    /* One allocation: the per-technique pointers, then every pass's plan */
+    for (i = 0; i < effect->technique_count; i++)
+        numpasses += effect->techniques[i].pass_count;
+    siz = (sizeof (PassPlan *) * effect->technique_count)
+        + (sizeof (PassPlan) * numpasses);
+    plans = (PassPlan **) m(siz, d);
+    if (plans == NULL)
+        return 0;
+    memset(plans, '\0', siz);
+    effect->runtime->pass_plans = plans;
+
+    plan = (PassPlan *) (plans + effect->technique_count);
+    for (i = 0; i < effect->technique_count; i++)
+    {
+        plans[i] = plan;
+        for (j = 0; j < effect->techniques[i].pass_count; j++, plan++)
+        {
+            /* If a pass sets a shader more than once, the last one wins */
+            const MOJOSHADER_effectPass *pass = &effect->techniques[i].passes[j];
+            for (k = 0; k < pass->state_count; k++)
+            {
+                state = &pass->states[k];
+                if ((state->type != MOJOSHADER_RS_VERTEXSHADER)
+                 && (state->type != MOJOSHADER_RS_PIXELSHADER))
+                    continue;
+                shader = stateshader(effect, state);
+                if (shader == NULL)
+                    continue;
+                else if (state->type == MOJOSHADER_RS_VERTEXSHADER)
+                    plan->vertex = shader;
+                else
+                    plan->pixel = shader;
+                if (shader->is_preshader)
+                    plan->has_preshader = 1;
+            } // for
+            planpasssamplers(plan);
+        } // for
+    } // for
+
+    return 1;
+} // buildpassplans
+
+static const MOJOSHADER_preshader *objectpreshader(const MOJOSHADER_effect *effect,
+                                                  const MOJOSHADER_effectShader *shader)
+{
+    const MOJOSHADER_parseData *pd;
+    if (shader->is_preshader)
+        return shader->preshader;
+    if (shader->shader == NULL)
+        return NULL;
+    pd = effect->ctx.getParseData(shader->shader);
+    return pd->preshader;
+} // objectpreshader
+
+static uint32 countpreshaderoutputs(const MOJOSHADER_preshader *preshader,
+                                    uint32 *output_index)
+{
+    uint32 i, j, k, count = 0;
+    for (i = 0; i < preshader->instruction_count; i++)
+    {
+        const MOJOSHADER_preshaderInstruction *inst = &preshader->instructions[i];
+        const MOJOSHADER_preshaderOperand *operand = &inst->operands[inst->operand_count - 1];
+        if (operand->type != MOJOSHADER_PRESHADEROPERAND_OUTPUT)
+            continue;
+        for (j = 0; j < inst->element_count; j++)
+        {
+            const uint32 index = operand->index + j;
+            if (output_index != NULL)
+            {
+                for (k = 0; k < count; k++)
+                    if (output_index[k] == index)
+                        break;
+                if (k < count)
+                    continue;
+                output_index[count] = index;
+            } // if
+            count++;
+        } // for
+    } // for
+    return count;
+} // countpreshaderoutputs
+
+/* Points (memo) at its part of (ptr), and returns where the next one goes */
+static uint32 *fillpreshadermemo(PreshaderMemo *memo,
+                                 const MOJOSHADER_effectShader *shader,
+                                 const MOJOSHADER_preshader *preshader,
+                                 uint32 *ptr,
+                                 MOJOSHADER_malloc m,
+                                 MOJOSHADER_free f,
+                                 void *d)
+{
+    memo->program = compilepreshader(preshader, m, f, d);
+    memo->input_count = shader->preshader_param_count;
+    memo->versions = ptr;
+    ptr += memo->input_count;
+    if (!shader->is_preshader)
+    {
+        memo->output_index = ptr;
+        memo->output_count = countpreshaderoutputs(preshader, ptr);
+        ptr += memo->output_count;
+        memo->outputs = (float *) ptr;
+        ptr += memo->output_count;
+    } // if
+    return ptr;
+} // fillpreshadermemo
+
+static int buildpreshadermemos(MOJOSHADER_effect *effect)
+{
+    int i;
+    MOJOSHADER_malloc m = effect->ctx.m;
+    MOJOSHADER_free f = effect->ctx.f;
+    void *d = effect->ctx.malloc_data;
+    const MOJOSHADER_preshader *preshader;
+    MOJOSHADER_effectShader *shader;
+    uint32 siz, numinputs = 0, numoutputs = 0;
+    PreshaderMemo *memos;
+    uint32 *ptr;
+
+    if (effect->object_count == 0) return 1;
+
+    /* One allocation: the memos, then all versions, then all outputs.
+     * The output count here is an upper bound, duplicates are dropped later.
+     */
+    for (i = 0; i < effect->object_count; i++)
+    {
+        if (effect->objects[i].type != MOJOSHADER_SYMTYPE_PIXELSHADER
+         && effect->objects[i].type != MOJOSHADER_SYMTYPE_VERTEXSHADER)
+            continue;
+        shader = &effect->objects[i].shader;
+        preshader = objectpreshader(effect, shader);
+        if (preshader == NULL)
+            continue;
+        numinputs += shader->preshader_param_count;
+        if (!shader->is_preshader)
+            numoutputs += countpreshaderoutputs(preshader, NULL);
+    } // for
+    siz = (sizeof (PreshaderMemo) * effect->object_count)
+        + (sizeof (uint32) * numinputs)
+        + ((sizeof (uint32) + sizeof (float)) * numoutputs);
+    memos = (PreshaderMemo *) m(siz, d);
+    if (memos == NULL)
+        return 0;
+    memset(memos, '\0', siz);
+    effect->runtime->preshader_memos = memos;
+
+    ptr = (uint32 *) (memos + effect->object_count);
+    for (i = 0; i < effect->object_count; i++)
+    {
+        if (effect->objects[i].type != MOJOSHADER_SYMTYPE_PIXELSHADER
+         && effect->objects[i].type != MOJOSHADER_SYMTYPE_VERTEXSHADER)
+            continue;
+        shader = &effect->objects[i].shader;
+        preshader = objectpreshader(effect, shader);
+        if (preshader == NULL)
+            continue;
+        ptr = fillpreshadermemo(&memos[i], shader,
+                                preshader, ptr, m, f, d);
+    } // for
+
+    return 1;
+} // buildpreshadermemos
+
+/* Allocates the parameter versions and dirty flags */
+static int starttracking(MOJOSHADER_effect *effect)
+{
+    MOJOSHADER_effectRuntime *runtime = effect->runtime;
+    const uint32 count = (uint32) effect->param_count;
+    uint32 siz;
+    uint8 *ptr;
+
+    if (count == 0) return 1;
+
+    siz = ((sizeof (uint32) * 2) + sizeof (uint8)) * count;
+    ptr = (uint8 *) effect->ctx.m(siz, effect->ctx.malloc_data);
+    if (ptr == NULL)
+        return 0;
+    memset(ptr, '\0', siz);
+
+    runtime->param_versions = (uint32 *) ptr;
+    runtime->dirty_params = runtime->param_versions + count;
+    runtime->param_dirty = (uint8 *) (runtime->dirty_params + count);
+    runtime->dirty_count = 0;
+    return 1;
+} // starttracking
+
+/* The effect structure and its runtime state, in one allocation */
+static MOJOSHADER_effect *alloceffect(MOJOSHADER_malloc m, void *d)
+{
+    const uint32 siz = sizeof (MOJOSHADER_effect) + sizeof (MOJOSHADER_effectRuntime);
+    MOJOSHADER_effect *retval = (MOJOSHADER_effect *) m(siz, d);
+    if (retval == NULL)
+        return NULL;
+    memset(retval, '\0', siz);
+    retval->runtime = (MOJOSHADER_effectRuntime *) (retval + 1);
+    return retval;
+} // alloceffect
+
+void freevalue(MOJOSHADER_effectValue *value, MOJOSHADER_free f, void *d);
+static void freevaluedata(MOJOSHADER_effectValue *value,
+                          MOJOSHADER_free f, void *d);
+
+static uint32 valuedatalen(const MOJOSHADER_effectValue *value)
+{
+    if (value->type.parameter_class == MOJOSHADER_SYMCLASS_OBJECT
+     && issamplertype(value->type.parameter_type))
+        return value->value_count * sizeof (MOJOSHADER_effectSamplerState);
+    return value->value_count * 4;
+} // valuedatalen
+
+/* Moves each parameter's values behind a ParamValueHeader. If that runs out
+ * of memory, the parameters left over lose their values, and this returns 0.
+ */
+static int homeparamvalues(MOJOSHADER_effect *effect,
+                           MOJOSHADER_malloc m,
+                           MOJOSHADER_free f,
+                           void *d)
+{
+    ParamValueHeader *header;
+    int i, retval = 1;
+
+    for (i = 0; i < effect->param_count; i++)
+    {
+        MOJOSHADER_effectValue *value = &effect->params[i].value;
+        const uint32 siz = valuedatalen(value);
+        if (value->values == NULL)
+            continue;
+
+        header = (retval) ? (ParamValueHeader *) m(sizeof (ParamValueHeader) + siz, d) : NULL;
+        if (header == NULL)
+        {
+            freevaluedata(value, f, d);
+            value->values = NULL;
+            value->value_count = 0;
+            retval = 0;
+            continue;
+        } // if
+
+        header->runtime = effect->runtime;
+        header->index = (uint32) i;
+        memcpy(header + 1, value->values, siz);
+        f(value->values, d);
+        value->values = header + 1;
+    } // for
+
+    return retval;
+} // homeparamvalues
+
+static void freeparamvalues(MOJOSHADER_effectValue *value,
+                            MOJOSHADER_free f, void *d)
+{
+    int i;
+    if (value->values == NULL)
+        return;
+    if (value->type.parameter_class == MOJOSHADER_SYMCLASS_OBJECT
+     && issamplertype(value->type.parameter_type))
+        for (i = 0; i < value->value_count; i++)
+            freevalue(&value->valuesSS[i].value, f, d);
+    f(((ParamValueHeader *) value->values) - 1, d);
+} // freeparamvalues
+
+/* Called by the setters, so change tracking knows what to copy */
+static inline void markparamset(const void *values)
+{
+    const ParamValueHeader *header;
+    MOJOSHADER_effectRuntime *runtime;
+
+    if (values == NULL)
+        return;
+    header = ((const ParamValueHeader *) values) - 1;
+    runtime = header->runtime;
+    if (!runtime->track_changes)
+        return;
+
+    runtime->param_versions[header->index]++;
+    if (!runtime->param_dirty[header->index])
+    {
+        runtime->param_dirty[header->index] = 1;
+        runtime->dirty_params[runtime->dirty_count++] = header->index;
+    } // if
+} // markparamset
+
+/* Compiles a lazy effect's shader object into the shared table, unless
+ * that's been done already. Returns 0 if it can't be compiled.
+ */
+static int compilelazyshader(MOJOSHADER_effect *effect, const uint32 index)
+{
+    MOJOSHADER_effectShared *shared = effect->runtime->shared;
+    LazyShader *lazy = &shared->lazy[index];
+    int retval = 1;
+
+    // A clone on another thread might want the same shader right now.
+    mutex_lock(shared->lock);
+    if ((lazy->tokenbuf == NULL) || (lazy->failed))
+        retval = 0;
+    else if (lazy->shader.shader != NULL)
+        retval = 1;
+    else if (!compileshaderobject(effect, &lazy->shader, index,
+                                  lazy->tokenbuf, lazy->bufsize,
+                                  shared->swiz, shared->swizcount,
+                                  shared->smap, shared->smapcount,
+                                  NULL))
+    {
+        // The backend's getError has the details.
+        if (lazy->shader.shader != NULL)
+            effect->ctx.deleteShader(effect->ctx.shaderContext, lazy->shader.shader);
+        lazy->shader.shader = NULL;
+        lazy->failed = 1;
+        retval = 0;
+    } // else if
+    mutex_unlock(shared->lock);
+    return retval;
+} // compilelazyshader
+
+/* Lazy effects compile each shader the first time something binds it, and
+ * share it with their clones. Returns 0 if the shader isn't available.
+ */
+static int loadshader(MOJOSHADER_effect *effect,
+                      MOJOSHADER_effectShader *shader)
+{
+    MOJOSHADER_effectShared *shared = effect->runtime->shared;
+    MOJOSHADER_malloc m = effect->ctx.m;
+    MOJOSHADER_free f = effect->ctx.f;
+    void *d = effect->ctx.malloc_data;
+    const MOJOSHADER_effectShader unloaded = *shader;
+    const MOJOSHADER_preshader *preshader;
+    PreshaderMemo *memo;
+    LazyShader *lazy;
+    uint32 index, siz;
+
+    if (shader->shader != NULL)
+        return 1;
+    else if ((shared == NULL) || (shared->lazy == NULL))
+        return 0;  // compiled at load time, or failed to.
+
+    // The shader is the first thing in its object, so this finds its index.
+    index = (uint32) ((const MOJOSHADER_effectObject *) shader - effect->objects);
+    lazy = &shared->lazy[index];
+
+    /* The first effect to need it compiles it for everyone */
+    if (!compilelazyshader(effect, index))
+        return 0;
+
+    *shader = lazy->shader;
+    shader->samplers = NULL;
+    if (!buildsamplers(effect, shader))
+        goto loadshader_outOfMemory;
+
+    preshader = objectpreshader(effect, shader);
+    if (preshader != NULL)
+    {
+        memo = &effect->runtime->preshader_memos[index];
+        siz = (sizeof (uint32) * shader->preshader_param_count)
+            + ((sizeof (uint32) + sizeof (float)) * countpreshaderoutputs(preshader, NULL));
+        memo->storage = m(siz, d);
+        if (memo->storage == NULL)
+            goto loadshader_outOfMemory;
+        memset(memo->storage, '\0', siz);
+        fillpreshadermemo(memo, shader, preshader, (uint32 *) memo->storage, m, f, d);
+    } // if
+
+    effect->ctx.shaderAddRef(shader->shader);
+    return 1;
+
+loadshader_outOfMemory:
+    f((void *) shader->samplers, d);
+    *shader = unloaded;
+    return 0;
+} // loadshader
+
+/* Loads the shaders a technique's passes bind directly. Shaders picked from
+ * an array by a preshader still wait for CommitChanges to choose them.
+ */
+static void loadtechnique(MOJOSHADER_effect *effect, const int technique)
+{
+    const PassPlan *plan = effect->runtime->pass_plans[technique];
+    int i;
+
+    for (i = 0; i < effect->techniques[technique].pass_count; i++, plan++)
+    {
+        if ((plan->vertex != NULL) && (!plan->vertex->is_preshader))
+            loadshader(effect, plan->vertex);
+        if ((plan->pixel != NULL) && (!plan->pixel->is_preshader))
+            loadshader(effect, plan->pixel);
+    } // for
+} // loadtechnique
+
+/* Call with the shared lock held */
+static void queuelazyshader(MOJOSHADER_effect *effect, const uint32 index)
+{
+    MOJOSHADER_effectShared *shared = effect->runtime->shared;
+    LazyShader *lazy;
+
+    if (index >= shared->object_count)
+        return;
+    lazy = &shared->lazy[index];
+    if ((lazy->tokenbuf == NULL) || (lazy->queued)
+     || (lazy->failed) || (lazy->shader.shader != NULL))
+        return;
+    lazy->queued = 1;
+    shared->prewarm[shared->prewarm_tail++] = index;
+} // queuelazyshader
+
+/* Queues a pass's shader, or for preshaders, every shader it picks from */
+static void queuepassshader(MOJOSHADER_effect *effect,
+                            const MOJOSHADER_effectShader *shader)
+{
+    const MOJOSHADER_effectValue *array;
+    uint32 i;
+
+    if (shader == NULL)
+        return;
+    else if (!shader->is_preshader)
+    {
+        queuelazyshader(effect, (uint32) ((const MOJOSHADER_effectObject *) shader - effect->objects));
+        return;
+    } // else if
+
+    if (shader->param_count == 0)
+        return;
+    array = &effect->params[shader->params[0]].value;
+    if (array->type.parameter_class != MOJOSHADER_SYMCLASS_OBJECT)
+        return;
+    for (i = 0; i < array->value_count; i++)
+        queuelazyshader(effect, (uint32) array->valuesI[i]);
+} // queuepassshader
+
+/* Translates every shader object the parser found on worker threads, then
+ * hands the results to the backend one at a time, in object order. Like
+ * the usual path, the first shader that fails stops the rest. Returns 0 if
+ * we ran out of memory; shader errors go in (errors).
+ */
+static int compileparallel(MOJOSHADER_effect *effect,
+                           const ParallelCompile *parallel,
+                           const MOJOSHADER_swizzle *swiz,
+                           const unsigned int swizcount,
+                           const MOJOSHADER_samplerMap *smap,
+                           const unsigned int smapcount,
+                           ErrorList *errors)
+{
+    MOJOSHADER_effectShared *shared = effect->runtime->shared;
+    MOJOSHADER_malloc m = effect->ctx.m;
+    MOJOSHADER_free f = effect->ctx.f;
+    void *d = effect->ctx.malloc_data;
+    MOJOSHADER_effectShader *shader;
+    const MOJOSHADER_parseData *pd;
+    MOJOSHADER_parseJob *jobs;
+    uint32 *indices;
+    char *mainfns;
+    uint32 i, jobcount = 0;
+    int failed = 0;
+
+    for (i = 0; i < shared->object_count; i++)
+        if (shared->lazy[i].tokenbuf != NULL)
+            jobcount++;
+    if (jobcount == 0)
+        return 1;
+
+    /* One allocation: the jobs, their object indices, then their mainfns */
+    jobs = (MOJOSHADER_parseJob *) m((sizeof (MOJOSHADER_parseJob) + sizeof (uint32) + 32) * jobcount, d);
+    if (jobs == NULL)
+        return 0;
+    indices = (uint32 *) (jobs + jobcount);
+    mainfns = (char *) (indices + jobcount);
+
+    jobcount = 0;
+    for (i = 0; i < shared->object_count; i++)
+    {
+        MOJOSHADER_parseJob *job = &jobs[jobcount];
+        if (shared->lazy[i].tokenbuf == NULL)
+            continue;
+        snprintf(mainfns + (32 * jobcount), 32, "ShaderFunction%u", (unsigned int) i);
+        job->profile = parallel->profile;
+        job->mainfn = mainfns + (32 * jobcount);
+        job->tokenbuf = shared->lazy[i].tokenbuf;
+        job->bufsize = shared->lazy[i].bufsize;
+        job->swiz = swiz;
+        job->swizcount = swizcount;
+        job->smap = smap;
+        job->smapcount = smapcount;
+        job->result = NULL;
+        indices[jobcount++] = i;
+    } // for
+
+    MOJOSHADER_parseBatch(jobs, jobcount, parallel->threadcount, m, f, d, NULL);
+
+    /* The backend gets the results on this thread, one at a time */
+    for (i = 0; i < jobcount; i++)
+    {
+        pd = jobs[i].result;
+        if (failed)
+        {
+            MOJOSHADER_freeParseData(pd);
+            continue;
+        } // if
+        else if (pd->error_count > 0)
+        {
+            push_errors(errors, pd->errors, pd->error_count);
+            MOJOSHADER_freeParseData(pd);
+            failed = 1;
+            continue;
+        } // else if
+
+        shader = &effect->objects[indices[i]].shader;
+        shader->shader = parallel->compileParsedShader(effect->ctx.shaderContext, pd);
+        if (shader->shader == NULL)
+        {
+            errorlist_add(errors, NULL, 0, effect->ctx.getError(effect->ctx.shaderContext));
+            failed = 1;
+        } // if
+        else if (!findshaderparams(effect, shader, errors))
+            failed = 1;
+        else if (!buildsamplers(effect, shader))
+        {
+            errorlist_add(errors, NULL, 0, "Out of memory");
+            failed = 1;
+        } // else if
+    } // for
+
+    f(jobs, d);
+    return 1;
+} // compileparallel
+
+static MOJOSHADER_effect *compileeffect(const unsigned char *buf,
+                                        const unsigned int _len,
+                                        const MOJOSHADER_swizzle *swiz,
+                                        const unsigned int swizcount,
+                                        const MOJOSHADER_samplerMap *smap,
+                                        const unsigned int smapcount,
+                                        const MOJOSHADER_effectShaderContext *ctx,
+                                        const ShaderLoad load,
+                                        const ParallelCompile *parallel)
 {
     const uint8 *ptr = (const uint8 *) buf;
     uint32 len = (uint32) _len;
@@ -961,11 +2316,9 @@ MOJOSHADER_effect *MOJOSHADER_compileEffect(const unsigned char *buf,
     d = ctx->malloc_data;
 
     /* malloc base effect structure */
-    MOJOSHADER_effect *retval = (MOJOSHADER_effect *) m(sizeof (MOJOSHADER_effect),
-                                                        ctx->malloc_data);
+    MOJOSHADER_effect *retval = alloceffect(m, d);
     if (retval == NULL)
         return &MOJOSHADER_out_of_mem_effect;
-    memset(retval, '\0', sizeof (*retval));
 
     /* Store ctx in effect structure */
     memcpy(&retval->ctx, ctx, sizeof(MOJOSHADER_effectShaderContext));
@@ -977,6 +2330,7 @@ MOJOSHADER_effect *MOJOSHADER_compileEffect(const unsigned char *buf,
 
     /* Read in header magic, seek to initial offset */
     const uint8 *base = NULL;
+    uint32 baselen = 0;
     uint16 magic;
     uint8 version_major;
     uint8 version_minor;
@@ -988,8 +2342,10 @@ MOJOSHADER_effect *MOJOSHADER_compileEffect(const unsigned char *buf,
          * -flibit
          */
         const uint32 skip = readui32(&ptr, &len) - 8;
+        if ((skip > len) || ((len - skip) < 4))
+            goto parseEffect_unexpectedEOF;
         ptr += skip;
-        len += skip;
+        len -= skip;
         read_version_token(&ptr, &len, &magic, &version_major, &version_minor);
     } // if
     if (!((magic == 0xFEFF) && (version_major == 0x09) && (version_minor == 0x01)))
@@ -1001,6 +2357,7 @@ MOJOSHADER_effect *MOJOSHADER_compileEffect(const unsigned char *buf,
     {
         const uint32 offset = readui32(&ptr, &len);
         base = ptr;
+        baselen = len;
         if (offset > len)
             goto parseEffect_unexpectedEOF;
         ptr += offset;
@@ -1011,10 +2368,10 @@ MOJOSHADER_effect *MOJOSHADER_compileEffect(const unsigned char *buf,
         goto parseEffect_unexpectedEOF;
 
     /* Parse structure counts */
-    const uint32 numparams = readui32(&ptr, &len);
-    const uint32 numtechniques = readui32(&ptr, &len);
+    const uint32 numparams = readcount(&ptr, &len, 16);
+    const uint32 numtechniques = readcount(&ptr, &len, 12);
     /*const uint32 FIXME =*/ readui32(&ptr, &len);
-    const uint32 numobjects = readui32(&ptr, &len);
+    const uint32 numobjects = readcount(&ptr, &len, 4);
 
     /* Alloc structures now, so object types can be stored */
     retval->object_count = numobjects;
@@ -1026,14 +2383,23 @@ MOJOSHADER_effect *MOJOSHADER_compileEffect(const unsigned char *buf,
 
     /* Parse effect parameters */
     retval->param_count = numparams;
-    readparameters(numparams, base, &ptr, &len,
-                   &retval->params, retval->objects,
+    readparameters(numparams, base, baselen, &ptr, &len,
+                   &retval->params, retval->objects, numobjects,
                    m, d);
+    if (!homeparamvalues(retval, m, f, d))
+        goto parseEffect_outOfMemory;
+    retval->runtime->shared = buildshared(retval->params, retval->param_count, m, f, d);
+    if (retval->runtime->shared == NULL)
+        goto parseEffect_outOfMemory;
+    if ((load != SHADERLOAD_EAGER)
+     && (!buildlazyshaders(retval->runtime->shared, load, numobjects,
+                           swiz, swizcount, smap, smapcount, m, d)))
+        goto parseEffect_outOfMemory;
 
     /* Parse effect techniques */
     retval->technique_count = numtechniques;
-    readtechniques(numtechniques, base, &ptr, &len,
-                   &retval->techniques, retval->objects,
+    readtechniques(numtechniques, base, baselen, &ptr, &len,
+                   &retval->techniques, retval->objects, numobjects,
                    m, d);
 
     /* Initial effect technique/pass */
@@ -1044,27 +2410,55 @@ MOJOSHADER_effect *MOJOSHADER_compileEffect(const unsigned char *buf,
         goto parseEffect_unexpectedEOF;
 
     /* Parse object counts */
-    const int numsmallobjects = readui32(&ptr, &len);
-    const int numlargeobjects = readui32(&ptr, &len);
+    const int numsmallobjects = readcount(&ptr, &len, 8);
+    const int numlargeobjects = readcount(&ptr, &len, 24);
 
     errors = errorlist_create(m, f, d);
     if (errors == NULL)
         goto parseEffect_outOfMemory;
 
     /* Parse "small" object table */
-    readsmallobjects(numsmallobjects, &ptr, &len, retval,
-                     swiz, swizcount, smap, smapcount, errors);
+    if (!readsmallobjects(numsmallobjects, &ptr, &len, retval,
+                          swiz, swizcount, smap, smapcount, errors))
+    {
+        errorlist_destroy(errors);
+        goto parseEffect_unexpectedEOF;
+    } // if
     if (errorlist_count(errors) == 0)
     {
         /* Parse "large" object table. */
-        readlargeobjects(numlargeobjects, numsmallobjects, &ptr, &len, retval,
-                         swiz, swizcount, smap, smapcount, errors);
+        if (!readlargeobjects(numlargeobjects, numsmallobjects, &ptr, &len, retval,
+                              swiz, swizcount, smap, smapcount, errors))
+        {
+            errorlist_destroy(errors);
+            goto parseEffect_unexpectedEOF;
+        } // if
+    } // if
+
+    if (load == SHADERLOAD_PARALLEL)
+    {
+        if ((errorlist_count(errors) == 0)
+         && (!compileparallel(retval, parallel, swiz, swizcount,
+                              smap, smapcount, errors)))
+        {
+            errorlist_destroy(errors);
+            goto parseEffect_outOfMemory;
+        } // if
+
+        /* Every shader is compiled now, so this is an ordinary effect */
+        f(retval->runtime->shared->lazy, d);
+        retval->runtime->shared->lazy = NULL;
     } // if
 
     retval->error_count = errorlist_count(errors);
     retval->errors = errorlist_flatten(errors);
     errorlist_destroy(errors);
 
+    if (!buildpassplans(retval))
+        goto parseEffect_outOfMemory;
+    if (!buildpreshadermemos(retval))
+        goto parseEffect_outOfMemory;
+
     return retval;
 
 parseEffect_unexpectedEOF:
@@ -1073,7 +2467,69 @@ parseEffect_unexpectedEOF:
 parseEffect_outOfMemory:
     MOJOSHADER_deleteEffect(retval);
     return &MOJOSHADER_out_of_mem_effect;
-} // MOJOSHADER_parseEffect
+} // compileeffect
+
+
+MOJOSHADER_effect *MOJOSHADER_compileEffect(const unsigned char *buf,
+                                            const unsigned int _len,
+                                            const MOJOSHADER_swizzle *swiz,
+                                            const unsigned int swizcount,
+                                            const MOJOSHADER_samplerMap *smap,
+                                            const unsigned int smapcount,
+                                            const MOJOSHADER_effectShaderContext *ctx)
+{
+    return compileeffect(buf, _len, swiz, swizcount, smap, smapcount, ctx,
+                         SHADERLOAD_EAGER, NULL);
+} // MOJOSHADER_compileEffect
+
+
+MOJOSHADER_effect *MOJOSHADER_compileEffectLazy(const unsigned char *buf,
+                                                const unsigned int _len,
+                                                const MOJOSHADER_swizzle *swiz,
+                                                const unsigned int swizcount,
+                                                const MOJOSHADER_samplerMap *smap,
+                                                const unsigned int smapcount,
+                                                const MOJOSHADER_effectShaderContext *ctx)
+{
+    return compileeffect(buf, _len, swiz, swizcount, smap, smapcount, ctx,
+                         SHADERLOAD_COPIED, NULL);
+} // MOJOSHADER_compileEffectLazy
+
+
+MOJOSHADER_effect *MOJOSHADER_compileEffectMapped(const unsigned char *buf,
+                                                  const unsigned int _len,
+                                                  const MOJOSHADER_swizzle *swiz,
+                                                  const unsigned int swizcount,
+                                                  const MOJOSHADER_samplerMap *smap,
+                                                  const unsigned int smapcount,
+                                                  const MOJOSHADER_effectShaderContext *ctx)
+{
+    return compileeffect(buf, _len, swiz, swizcount, smap, smapcount, ctx,
+                         SHADERLOAD_MAPPED, NULL);
+} // MOJOSHADER_compileEffectMapped
+
+
+MOJOSHADER_effect *MOJOSHADER_compileEffectThreaded(const unsigned char *buf,
+                                                    const unsigned int _len,
+                                                    const MOJOSHADER_swizzle *swiz,
+                                                    const unsigned int swizcount,
+                                                    const MOJOSHADER_samplerMap *smap,
+                                                    const unsigned int smapcount,
+                                                    const MOJOSHADER_effectShaderContext *ctx,
+                                                    const char *profile,
+                                                    MOJOSHADER_compileParsedShaderFunc compileParsedShader,
+                                                    const unsigned int threadcount)
+{
+    ParallelCompile parallel;
+    if ((profile == NULL) || (compileParsedShader == NULL))
+        return MOJOSHADER_compileEffect(buf, _len, swiz, swizcount,
+                                        smap, smapcount, ctx);
+    parallel.profile = profile;
+    parallel.compileParsedShader = compileParsedShader;
+    parallel.threadcount = threadcount;
+    return compileeffect(buf, _len, swiz, swizcount, smap, smapcount, ctx,
+                         SHADERLOAD_PARALLEL, &parallel);
+} // MOJOSHADER_compileEffectThreaded
 
 
 void freetypeinfo(MOJOSHADER_symbolTypeInfo *typeinfo,
@@ -1089,29 +2545,32 @@ void freetypeinfo(MOJOSHADER_symbolTypeInfo *typeinfo,
 } // freetypeinfo
 
 
-void freevalue(MOJOSHADER_effectValue *value, MOJOSHADER_free f, void *d)
+/* Just the values, not the name or type, which clones share */
+static void freevaluedata(MOJOSHADER_effectValue *value,
+                          MOJOSHADER_free f, void *d)
 {
     int i;
-    f((void *) value->name, d);
-    f((void *) value->semantic, d);
-    freetypeinfo(&value->type, f, d);
-    if (value->type.parameter_type == MOJOSHADER_SYMTYPE_SAMPLER
-     || value->type.parameter_type == MOJOSHADER_SYMTYPE_SAMPLER1D
-     || value->type.parameter_type == MOJOSHADER_SYMTYPE_SAMPLER2D
-     || value->type.parameter_type == MOJOSHADER_SYMTYPE_SAMPLER3D
-     || value->type.parameter_type == MOJOSHADER_SYMTYPE_SAMPLERCUBE)
+    if (value->type.parameter_class == MOJOSHADER_SYMCLASS_OBJECT
+     && issamplertype(value->type.parameter_type))
         for (i = 0; i < value->value_count; i++)
             freevalue(&value->valuesSS[i].value, f, d);
     f(value->values, d);
-} // freevalue
+} // freevaluedata
 
 
-void MOJOSHADER_deleteEffect(const MOJOSHADER_effect *_effect)
+void freevalue(MOJOSHADER_effectValue *value, MOJOSHADER_free f, void *d)
 {
-    MOJOSHADER_effect *effect = (MOJOSHADER_effect *) _effect;
-    if ((effect == NULL) || (effect == &MOJOSHADER_out_of_mem_effect))
-        return;  // no-op.
+    f((void *) value->name, d);
+    f((void *) value->semantic, d);
+    freetypeinfo(&value->type, f, d);
+    freevaluedata(value, f, d);
+} // freevalue
+
 
+/* Free what an effect shares with its clones, once the last one goes */
+static void freeshared(MOJOSHADER_effect *effect)
+{
+    MOJOSHADER_effectShared *shared = effect->runtime->shared;
     MOJOSHADER_free f = effect->ctx.f;
     void *d = effect->ctx.malloc_data;
     int i, j, k;
@@ -1124,18 +2583,19 @@ void MOJOSHADER_deleteEffect(const MOJOSHADER_effect *_effect)
     } // for
     f((void *) effect->errors, d);
 
-    /* Free parameters, including annotations */
+    /* Free parameter names, types and annotations */
     for (i = 0; i < effect->param_count; i++)
     {
         MOJOSHADER_effectParam *param = &effect->params[i];
-        freevalue(&param->value, f, d);
+        f((void *) param->value.name, d);
+        f((void *) param->value.semantic, d);
+        freetypeinfo(&param->value.type, f, d);
         for (j = 0; j < param->annotation_count; j++)
         {
             freevalue(&param->annotations[j], f, d);
         } // for
         f((void *) param->annotations, d);
     } // for
-    f((void *) effect->params, d);
 
     /* Free techniques, including passes and all annotations */
     for (i = 0; i < effect->technique_count; i++)
@@ -1166,7 +2626,9 @@ void MOJOSHADER_deleteEffect(const MOJOSHADER_effect *_effect)
     } // for
     f((void *) effect->techniques, d);
 
-    /* Free object table */
+    /* Free object strings, parameter indices and preshaders. Shaders that
+     * were compiled on first use have theirs in the shared table instead.
+     */
     for (i = 0; i < effect->object_count; i++)
     {
         MOJOSHADER_effectObject *object = &effect->objects[i];
@@ -1175,24 +2637,89 @@ void MOJOSHADER_deleteEffect(const MOJOSHADER_effect *_effect)
         {
             if (object->shader.is_preshader)
                 MOJOSHADER_freePreshader(object->shader.preshader);
-            else
-                effect->ctx.deleteShader(effect->ctx.shaderContext, object->shader.shader);
+            else if ((shared != NULL) && (shared->lazy != NULL))
+                continue;
             f((void *) object->shader.params, d);
-            f((void *) object->shader.samplers, d);
             f((void *) object->shader.preshader_params, d);
         } // if
-        else if (object->type == MOJOSHADER_SYMTYPE_SAMPLER
-              || object->type == MOJOSHADER_SYMTYPE_SAMPLER1D
-              || object->type == MOJOSHADER_SYMTYPE_SAMPLER2D
-              || object->type == MOJOSHADER_SYMTYPE_SAMPLER3D
-              || object->type == MOJOSHADER_SYMTYPE_SAMPLERCUBE)
+        else if ((object->type >= MOJOSHADER_SYMTYPE_TEXTURE)
+              && (object->type <= MOJOSHADER_SYMTYPE_SAMPLERCUBE))
             f((void *) object->mapping.name, d);
         else if (object->type == MOJOSHADER_SYMTYPE_STRING)
             f((void *) object->string.string, d);
     } // for
+
+    /* Drop the shared table's own references to lazily compiled shaders */
+    if ((shared != NULL) && (shared->lazy != NULL))
+    {
+        for (i = 0; i < shared->object_count; i++)
+        {
+            void *shader = shared->lazy[i].shader.shader;
+            if (shader != NULL)
+                effect->ctx.deleteShader(effect->ctx.shaderContext, shader);
+        } // for
+    } // if
+    destroyshared(shared);
+} // freeshared
+
+
+void MOJOSHADER_deleteEffect(const MOJOSHADER_effect *_effect)
+{
+    MOJOSHADER_effect *effect = (MOJOSHADER_effect *) _effect;
+    if ((effect == NULL) || (effect == &MOJOSHADER_out_of_mem_effect))
+        return;  // no-op.
+
+    MOJOSHADER_free f = effect->ctx.f;
+    void *d = effect->ctx.malloc_data;
+    MOJOSHADER_effectRuntime *runtime = effect->runtime;
+    const int last = releaseshared(runtime->shared);
+    int i;
+
+    /* Free parameter values */
+    for (i = 0; i < effect->param_count; i++)
+        freeparamvalues(&effect->params[i].value, f, d);
+
+    /* Free shader references, samplers and preshader registers */
+    for (i = 0; i < effect->object_count; i++)
+    {
+        MOJOSHADER_effectObject *object = &effect->objects[i];
+        if (object->type != MOJOSHADER_SYMTYPE_PIXELSHADER
+         && object->type != MOJOSHADER_SYMTYPE_VERTEXSHADER)
+            continue;
+        if (!object->shader.is_preshader)
+        {
+            // Mapped effects may not have compiled this one yet.
+            if (object->shader.shader != NULL)
+                effect->ctx.deleteShader(effect->ctx.shaderContext, object->shader.shader);
+        } // if
+        else if ((!last) && (object->shader.preshader != NULL))
+        {
+            // Only the registers are ours, see sharepreshader().
+            f((void *) object->shader.preshader->registers, d);
+            f((void *) object->shader.preshader, d);
+        } // else if
+        f((void *) object->shader.samplers, d);
+    } // for
+
+    if (last)
+        freeshared(effect);
+    f((void *) effect->params, d);
     f((void *) effect->objects, d);
 
-    /* Free base effect structure */
+    /* Free pass plans, parameter tracking and preshader memos */
+    f((void *) runtime->pass_plans, d);
+    f((void *) runtime->param_versions, d);
+    if (runtime->preshader_memos != NULL)
+    {
+        for (i = 0; i < effect->object_count; i++)
+        {
+            freepreshaderprogram(runtime->preshader_memos[i].program, f, d);
+            f(runtime->preshader_memos[i].storage, d);
+        } // for
+        f((void *) runtime->preshader_memos, d);
+    } // if
+
+    /* Free base effect structure, and the runtime state after it */
     f((void *) effect, d);
 } // MOJOSHADER_freeEffect
 
@@ -1233,15 +2760,17 @@ void copysymboltypeinfo(MOJOSHADER_symbolTypeInfo *dst,
 void copyvalue(MOJOSHADER_effectValue *dst,
                MOJOSHADER_effectValue *src,
                MOJOSHADER_malloc m,
-               void *d)
+               void *d);
+
+/* Just the values; (dst) must already have (src)'s type */
+static void copyvaluedata(MOJOSHADER_effectValue *dst,
+                          MOJOSHADER_effectValue *src,
+                          MOJOSHADER_malloc m,
+                          void *d)
 {
     int i;
     uint32 siz = 0;
-    char *stringcopy = NULL;
 
-    COPY_STRING(name)
-    COPY_STRING(semantic)
-    copysymboltypeinfo(&dst->type, &src->type, m, d);
     dst->value_count = src->value_count;
 
     if (dst->type.parameter_class == MOJOSHADER_SYMCLASS_SCALAR
@@ -1283,166 +2812,83 @@ void copyvalue(MOJOSHADER_effectValue *dst,
             memcpy(dst->values, src->values, siz);
         } // else
     } // else if
-
-} // copyvalue
-
-
-#undef COPY_STRING
+} // copyvaluedata
 
 
-void copysymbolinfo(MOJOSHADER_symbolTypeInfo *dst,
-                    MOJOSHADER_symbolTypeInfo *src,
-                    MOJOSHADER_malloc m,
-                    void *d)
+void copyvalue(MOJOSHADER_effectValue *dst,
+               MOJOSHADER_effectValue *src,
+               MOJOSHADER_malloc m,
+               void *d)
 {
-    int i;
-    uint32 siz;
-    char *stringcopy;
-
-    dst->parameter_class = src->parameter_class;
-    dst->parameter_type = src->parameter_type;
-    dst->rows = src->rows;
-    dst->columns = src->columns;
-    dst->elements = src->elements;
-    dst->member_count = src->member_count;
+    uint32 siz = 0;
+    char *stringcopy = NULL;
 
-    if (dst->member_count > 0)
-    {
-        siz = sizeof (MOJOSHADER_symbolStructMember) * dst->member_count;
-        dst->members = (MOJOSHADER_symbolStructMember *) m(siz, d);
-        // !!! FIXME: Out of memory check!
-        for (i = 0; i < dst->member_count; i++)
-        {
-            if (src->members[i].name != NULL)
-            {
-                siz = strlen(src->members[i].name) + 1;
-                stringcopy = (char *) m(siz, d);
-                strcpy(stringcopy, src->members[i].name);
-                dst->members[i].name = stringcopy;
-            } // if
-            copysymbolinfo(&dst->members[i].info, &src->members[i].info, m, d);
-        } // for
-    } // if
-} // copysymbolinfo
+    COPY_STRING(name)
+    COPY_STRING(semantic)
+    copysymboltypeinfo(&dst->type, &src->type, m, d);
+    copyvaluedata(dst, src, m, d);
+} // copyvalue
 
 
-void copysymbol(MOJOSHADER_symbol *dst,
-                MOJOSHADER_symbol *src,
-                MOJOSHADER_malloc m,
-                void *d)
-{
-    uint32 siz = strlen(src->name) + 1;
-    char *stringcopy = (char *) m(siz, d);
-    // !!! FIXME: Out of memory check!
-    strcpy(stringcopy, src->name);
-    dst->name = stringcopy;
-    dst->register_set = src->register_set;
-    dst->register_index = src->register_index;
-    dst->register_count = src->register_count;
-    copysymbolinfo(&dst->info, &src->info, m, d);
-} // copysymbol
+#undef COPY_STRING
 
 
-MOJOSHADER_preshader *copypreshader(const MOJOSHADER_preshader *src,
-                                    MOJOSHADER_malloc m,
-                                    void *d)
+/* A copy of (src) with its own registers, sharing everything else */
+static MOJOSHADER_preshader *sharepreshader(const MOJOSHADER_preshader *src,
+                                            MOJOSHADER_malloc m,
+                                            MOJOSHADER_free f,
+                                            void *d)
 {
-    int i, j;
-    uint32 siz;
+    const uint32 siz = sizeof (float) * 4 * src->register_count;
     MOJOSHADER_preshader *retval;
 
     retval = (MOJOSHADER_preshader *) m(sizeof (MOJOSHADER_preshader), d);
-    // !!! FIXME: Out of memory check!
-    memset(retval, '\0', sizeof (MOJOSHADER_preshader));
-
-    siz = sizeof (double) * src->literal_count;
-    retval->literal_count = src->literal_count;
-    retval->literals = (double *) m(siz, d);
-    // !!! FIXME: Out of memory check!
-    memcpy(retval->literals, src->literals, siz);
-
-    retval->temp_count = src->temp_count;
-
-    siz = sizeof (MOJOSHADER_symbol) * src->symbol_count;
-    retval->symbol_count = src->symbol_count;
-    retval->symbols = (MOJOSHADER_symbol *) m(siz, d);
-    // !!! FIXME: Out of memory check!
-    memset(retval->symbols, '\0', siz);
-
-    for (i = 0; i < retval->symbol_count; i++)
-        copysymbol(&retval->symbols[i], &src->symbols[i], m, d);
-
-    siz = sizeof (MOJOSHADER_preshaderInstruction) * src->instruction_count;
-    retval->instruction_count = src->instruction_count;
-    retval->instructions = (MOJOSHADER_preshaderInstruction *) m(siz, d);
-    // !!! FIXME: Out of memory check!
-    memcpy(retval->instructions, src->instructions, siz);
-    for (i = 0; i < retval->instruction_count; i++)
-        for (j = 0; j < retval->instructions[i].operand_count; j++)
-        {
-            siz = sizeof (unsigned int) * retval->instructions[i].operands[j].array_register_count;
-            retval->instructions[i].operands[j].array_registers = (unsigned int *) m(siz, d);
-            // !!! FIXME: Out of memory check!
-            memcpy(retval->instructions[i].operands[j].array_registers,
-                   src->instructions[i].operands[j].array_registers,
-                   siz);
-        } // for
+    if (retval == NULL)
+        return NULL;
+    memcpy(retval, src, sizeof (MOJOSHADER_preshader));
 
-    siz = sizeof (float) * 4 * src->register_count;
-    retval->register_count = src->register_count;
     retval->registers = (float *) m(siz, d);
-    // !!! FIXME: Out of memory check!
+    if (retval->registers == NULL)
+    {
+        f(retval, d);
+        return NULL;
+    } // if
     memcpy(retval->registers, src->registers, siz);
 
     return retval;
-} // copypreshader
+} // sharepreshader
 
 
 MOJOSHADER_effect *MOJOSHADER_cloneEffect(const MOJOSHADER_effect *effect)
 {
-    int i, j, k;
-    MOJOSHADER_parseData *pd;
+    int i;
     MOJOSHADER_effect *clone;
     MOJOSHADER_malloc m = effect->ctx.m;
+    MOJOSHADER_free f = effect->ctx.f;
     void *d = effect->ctx.malloc_data;
     uint32 siz = 0;
-    char *stringcopy = NULL;
-    uint32 curSampler;
 
     if ((effect == NULL) || (effect == &MOJOSHADER_out_of_mem_effect))
         return NULL;  // no-op.
 
-    clone = (MOJOSHADER_effect *) m(sizeof (MOJOSHADER_effect), d);
+    clone = alloceffect(m, d);
     if (clone == NULL)
         return NULL; // Maybe out_of_mem_effect instead?
-    memset(clone, '\0', sizeof (MOJOSHADER_effect));
 
     /* Copy ctx */
     memcpy(&clone->ctx, &effect->ctx, sizeof(MOJOSHADER_effectShaderContext));
 
-    #define COPY_STRING(location) \
-        siz = strlen(effect->location) + 1; \
-        stringcopy = (char *) m(siz, d); \
-        if (stringcopy == NULL) \
-            goto cloneEffect_outOfMemory; \
-        strcpy(stringcopy, effect->location); \
-        clone->location = stringcopy; \
+    /* Take a reference on everything that can't change, before pointing at
+     * any of it, so a failed clone can't free it out from under (effect).
+     */
+    clone->runtime->shared = effect->runtime->shared;
+    atomic_add(&clone->runtime->shared->refcount, 1);
 
-    /* Copy errors */
-    siz = sizeof (MOJOSHADER_error) * effect->error_count;
+    /* Share errors */
     clone->error_count = effect->error_count;
-    clone->errors = (MOJOSHADER_error *) m(siz, d);
-    if (clone->errors == NULL)
-        goto cloneEffect_outOfMemory;
-    memset(clone->errors, '\0', siz);
-    for (i = 0; i < clone->error_count; i++)
-    {
-        COPY_STRING(errors[i].error)
-        COPY_STRING(errors[i].filename)
-        clone->errors[i].error_position = effect->errors[i].error_position;
-    } // for
+    clone->errors = effect->errors;
 
-    /* Copy parameters */
+    /* Copy parameters, but only their values are the clone's own */
     siz = sizeof (MOJOSHADER_effectParam) * effect->param_count;
     clone->param_count = effect->param_count;
     clone->params = (MOJOSHADER_effectParam *) m(siz, d);
@@ -1451,97 +2897,25 @@ MOJOSHADER_effect *MOJOSHADER_cloneEffect(const MOJOSHADER_effect *effect)
     memset(clone->params, '\0', siz);
     for (i = 0; i < clone->param_count; i++)
     {
-        copyvalue(&clone->params[i].value, &effect->params[i].value, m, d);
-
-        /* Copy parameter annotations */
-        siz = sizeof (MOJOSHADER_effectAnnotation) * effect->params[i].annotation_count;
+        clone->params[i].value = effect->params[i].value;
+        clone->params[i].value.values = NULL;
+        copyvaluedata(&clone->params[i].value, &effect->params[i].value, m, d);
         clone->params[i].annotation_count = effect->params[i].annotation_count;
-        clone->params[i].annotations = (MOJOSHADER_effectAnnotation *) m(siz, d);
-        if (clone->params[i].annotations == NULL)
-            goto cloneEffect_outOfMemory;
-        memset(clone->params[i].annotations, '\0', siz);
-        for (j = 0; j < clone->params[i].annotation_count; j++)
-            copyvalue(&clone->params[i].annotations[j],
-                      &effect->params[i].annotations[j],
-                      m, d);
+        clone->params[i].annotations = effect->params[i].annotations;
     } // for
-
-    /* Copy techniques */
-    siz = sizeof (MOJOSHADER_effectTechnique) * effect->technique_count;
-    clone->technique_count = effect->technique_count;
-    clone->techniques = (MOJOSHADER_effectTechnique *) m(siz, d);
-    if (clone->techniques == NULL)
+    if (!homeparamvalues(clone, m, f, d))
         goto cloneEffect_outOfMemory;
-    memset(clone->techniques, '\0', siz);
-    for (i = 0; i < clone->technique_count; i++)
-    {
-        COPY_STRING(techniques[i].name)
-
-        /* Copy passes */
-        siz = sizeof (MOJOSHADER_effectPass) * effect->techniques[i].pass_count;
-        clone->techniques[i].pass_count = effect->techniques[i].pass_count;
-        clone->techniques[i].passes = (MOJOSHADER_effectPass *) m(siz, d);
-        if (clone->techniques[i].passes == NULL)
-            goto cloneEffect_outOfMemory;
-        memset(clone->techniques[i].passes, '\0', siz);
-        for (j = 0; j < clone->techniques[i].pass_count; j++)
-        {
-            COPY_STRING(techniques[i].passes[j].name)
-
-            /* Copy pass states */
-            siz = sizeof (MOJOSHADER_effectState) * effect->techniques[i].passes[j].state_count;
-            clone->techniques[i].passes[j].state_count = effect->techniques[i].passes[j].state_count;
-            clone->techniques[i].passes[j].states = (MOJOSHADER_effectState *) m(siz, d);
-            if (clone->techniques[i].passes[j].states == NULL)
-                goto cloneEffect_outOfMemory;
-            memset(clone->techniques[i].passes[j].states, '\0', siz);
-            for (k = 0; k < clone->techniques[i].passes[j].state_count; k++)
-            {
-                clone->techniques[i].passes[j].states[k].type = effect->techniques[i].passes[j].states[k].type;
-                copyvalue(&clone->techniques[i].passes[j].states[k].value,
-                          &effect->techniques[i].passes[j].states[k].value,
-                          m, d);
-            } // for
-
-            /* Copy pass annotations */
-            siz = sizeof (MOJOSHADER_effectAnnotation) * effect->techniques[i].passes[j].annotation_count;
-            clone->techniques[i].passes[j].annotation_count = effect->techniques[i].passes[j].annotation_count;
-            clone->techniques[i].passes[j].annotations = (MOJOSHADER_effectAnnotation *) m(siz, d);
-            if (clone->techniques[i].passes[j].annotations == NULL)
-                goto cloneEffect_outOfMemory;
-            memset(clone->techniques[i].passes[j].annotations, '\0', siz);
-            for (k = 0; k < clone->techniques[i].passes[j].annotation_count; k++)
-                copyvalue(&clone->techniques[i].passes[j].annotations[k],
-                          &effect->techniques[i].passes[j].annotations[k],
-                          m, d);
-        } // for
-
-        /* Copy technique annotations */
-        siz = sizeof (MOJOSHADER_effectAnnotation) * effect->techniques[i].annotation_count;
-        clone->techniques[i].annotation_count = effect->techniques[i].annotation_count;
-        clone->techniques[i].annotations = (MOJOSHADER_effectAnnotation *) m(siz, d);
-        if (clone->techniques[i].annotations == NULL)
-            goto cloneEffect_outOfMemory;
-        memset(clone->techniques[i].annotations, '\0', siz);
-        for (j = 0; j < clone->techniques[i].annotation_count; j++)
-            copyvalue(&clone->techniques[i].annotations[j],
-                      &effect->techniques[i].annotations[j],
-                      m, d);
-    } // for
 
-    /* Copy the current technique, but do NOT copy the pass, pass >= 0 just
-     * means that the effect we're cloning is currently active
+    /* Share techniques, passes and their states and annotations. Copy the
+     * current technique, but do NOT copy the pass, pass >= 0 just means that
+     * the effect we're cloning is currently active
      */
-    for (i = 0; i < effect->technique_count; i++)
-        if (&effect->techniques[i] == effect->current_technique)
-        {
-            clone->current_technique = &clone->techniques[i];
-            break;
-        } // if
-    assert(clone->current_technique != NULL);
+    clone->technique_count = effect->technique_count;
+    clone->techniques = effect->techniques;
+    clone->current_technique = effect->current_technique;
     clone->current_pass = -1;
 
-    /* Copy object table */
+    /* Copy object table, sharing strings and parameter indices */
     siz = sizeof (MOJOSHADER_effectObject) * effect->object_count;
     clone->object_count = effect->object_count;
     clone->objects = (MOJOSHADER_effectObject *) m(siz, d);
@@ -1550,68 +2924,43 @@ MOJOSHADER_effect *MOJOSHADER_cloneEffect(const MOJOSHADER_effect *effect)
     memset(clone->objects, '\0', siz);
     for (i = 0; i < clone->object_count; i++)
     {
-        clone->objects[i].type = effect->objects[i].type;
-        if (clone->objects[i].type == MOJOSHADER_SYMTYPE_PIXELSHADER
-         || clone->objects[i].type == MOJOSHADER_SYMTYPE_VERTEXSHADER)
-        {
-            clone->objects[i].shader.technique = effect->objects[i].shader.technique;
-            clone->objects[i].shader.pass = effect->objects[i].shader.pass;
-            clone->objects[i].shader.is_preshader = effect->objects[i].shader.is_preshader;
-            siz = sizeof (uint32) * effect->objects[i].shader.preshader_param_count;
-            clone->objects[i].shader.preshader_param_count = effect->objects[i].shader.preshader_param_count;
-            clone->objects[i].shader.preshader_params = (uint32 *) m(siz, d);
-            memcpy(clone->objects[i].shader.preshader_params,
-                   effect->objects[i].shader.preshader_params,
-                   siz);
-            siz = sizeof (uint32) * effect->objects[i].shader.param_count;
-            clone->objects[i].shader.param_count = effect->objects[i].shader.param_count;
-            clone->objects[i].shader.params = (uint32 *) m(siz, d);
-            memcpy(clone->objects[i].shader.params,
-                   effect->objects[i].shader.params,
-                   siz);
-
-            if (clone->objects[i].shader.is_preshader)
-            {
-                clone->objects[i].shader.preshader = copypreshader(effect->objects[i].shader.preshader,
-                                                                   m, d);
-                continue;
-            } // if
+        MOJOSHADER_effectShader *shader = &clone->objects[i].shader;
+        const MOJOSHADER_effectShader *src = &effect->objects[i].shader;
 
-            effect->ctx.shaderAddRef(effect->objects[i].shader.shader);
-            clone->objects[i].shader.shader = effect->objects[i].shader.shader;
-            pd = clone->ctx.getParseData(clone->objects[i].shader.shader);
+        clone->objects[i] = effect->objects[i];
+        if (clone->objects[i].type != MOJOSHADER_SYMTYPE_PIXELSHADER
+         && clone->objects[i].type != MOJOSHADER_SYMTYPE_VERTEXSHADER)
+            continue;
 
-            siz = sizeof (MOJOSHADER_samplerStateRegister) * effect->objects[i].shader.sampler_count;
-            clone->objects[i].shader.sampler_count = effect->objects[i].shader.sampler_count;
-            clone->objects[i].shader.samplers = (MOJOSHADER_samplerStateRegister *) m(siz, d);
-            if (clone->objects[i].shader.samplers == NULL)
+        shader->samplers = NULL;
+        if (shader->is_preshader)
+        {
+            // Each clone fills in its own registers at commit time.
+            shader->preshader = sharepreshader(src->preshader, m, f, d);
+            if (shader->preshader == NULL)
                 goto cloneEffect_outOfMemory;
-            curSampler = 0;
-            for (j = 0; j < pd->symbol_count; j++)
-                if (pd->symbols[j].register_set == MOJOSHADER_SYMREGSET_SAMPLER)
-                {
-                    clone->objects[i].shader.samplers[curSampler].sampler_name = clone->params[clone->objects[i].shader.params[j]].value.name;
-                    clone->objects[i].shader.samplers[curSampler].sampler_register = pd->symbols[j].register_index;
-                    clone->objects[i].shader.samplers[curSampler].sampler_state_count = clone->params[clone->objects[i].shader.params[j]].value.value_count;
-                    clone->objects[i].shader.samplers[curSampler].sampler_states = clone->params[clone->objects[i].shader.params[j]].value.valuesSS;
-                    curSampler++;
-                } // if
+            continue;
         } // if
-        else if (clone->objects[i].type == MOJOSHADER_SYMTYPE_SAMPLER
-              || clone->objects[i].type == MOJOSHADER_SYMTYPE_SAMPLER1D
-              || clone->objects[i].type == MOJOSHADER_SYMTYPE_SAMPLER2D
-              || clone->objects[i].type == MOJOSHADER_SYMTYPE_SAMPLER3D
-              || clone->objects[i].type == MOJOSHADER_SYMTYPE_SAMPLERCUBE)
-        {
-            COPY_STRING(objects[i].mapping.name)
-        } // else if
-        else if (clone->objects[i].type == MOJOSHADER_SYMTYPE_STRING)
-        {
-            COPY_STRING(objects[i].string.string)
-        } // else if
+
+        // Not compiled yet (or ever), the clone will do that on its own.
+        if (src->shader == NULL)
+            continue;
+
+        effect->ctx.shaderAddRef(src->shader);
+        if (!buildsamplers(clone, shader))
+            goto cloneEffect_outOfMemory;
     } // for
 
-    #undef COPY_STRING
+    /* Plans and memos point at objects, so the clone needs its own */
+    if (!buildpassplans(clone))
+        goto cloneEffect_outOfMemory;
+    if (!buildpreshadermemos(clone))
+        goto cloneEffect_outOfMemory;
+
+    /* The clone has its own values, so it tracks them on its own, too */
+    if ((effect->runtime->track_changes) && (!starttracking(clone)))
+        goto cloneEffect_outOfMemory;
+    clone->runtime->track_changes = effect->runtime->track_changes;
 
     return clone;
 
@@ -1628,6 +2977,7 @@ void MOJOSHADER_effectSetRawValueHandle(const MOJOSHADER_effectParam *parameter,
 {
     // !!! FIXME: char* case is arbitary, for Win32 -flibit
     memcpy((char *) parameter->value.values + offset, data, len);
+    markparamset(parameter->value.values);
 } // MOJOSHADER_effectSetRawValueHandle
 
 
@@ -1637,20 +2987,55 @@ void MOJOSHADER_effectSetRawValueName(const MOJOSHADER_effect *effect,
                                       const unsigned int offset,
                                       const unsigned int len)
 {
-    int i;
-    for (i = 0; i < effect->param_count; i++)
+    const int i = paramindex(effect, name);
+    if (i >= 0)
     {
-        if (strcmp(name, effect->params[i].value.name) == 0)
-        {
-            // !!! FIXME: char* case is arbitary, for Win32 -flibit
-            memcpy((char *) effect->params[i].value.values + offset, data, len);
-            return;
-        } // if
-    } // for
+        // !!! FIXME: char* case is arbitary, for Win32 -flibit
+        memcpy((char *) effect->params[i].value.values + offset, data, len);
+        markparamset(effect->params[i].value.values);
+        return;
+    } // if
     assert(0 && "Effect parameter not found!");
 } // MOJOSHADER_effectSetRawValueName
 
 
+const MOJOSHADER_effectParam *MOJOSHADER_effectGetParameterByName(const MOJOSHADER_effect *effect,
+                                                                  const char *name)
+{
+    const int i = paramindex(effect, name);
+    return (i >= 0) ? &effect->params[i] : NULL;
+} // MOJOSHADER_effectGetParameterByName
+
+
+void MOJOSHADER_effectTrackChanges(MOJOSHADER_effect *effect, int enable)
+{
+    MOJOSHADER_effectRuntime *runtime = effect->runtime;
+    int i;
+
+    if (runtime == NULL)
+        return;  // one of the static error effects.
+    if (enable && (runtime->param_versions == NULL) && !starttracking(effect))
+        enable = 0;  // out of memory, just keep copying everything.
+    runtime->track_changes = enable;
+
+    // Whatever was tracked before this can't be trusted.
+    runtime->committed_vert_raw = NULL;
+    runtime->committed_pixl_raw = NULL;
+    for (i = 0; i < effect->object_count; i++)
+        runtime->preshader_memos[i].valid = 0;
+} // MOJOSHADER_effectTrackChanges
+
+
+void MOJOSHADER_effectGetPreshaderStats(const MOJOSHADER_effect *effect,
+                                        unsigned int *hits,
+                                        unsigned int *misses)
+{
+    const MOJOSHADER_effectRuntime *runtime = effect->runtime;
+    *hits = (runtime != NULL) ? runtime->preshader_hits : 0;
+    *misses = (runtime != NULL) ? runtime->preshader_misses : 0;
+} // MOJOSHADER_effectGetPreshaderStats
+
+
 const MOJOSHADER_effectTechnique *MOJOSHADER_effectGetCurrentTechnique(const MOJOSHADER_effect *effect)
 {
     return effect->current_technique;
@@ -1666,6 +3051,8 @@ void MOJOSHADER_effectSetTechnique(MOJOSHADER_effect *effect,
         if (technique == &effect->techniques[i])
         {
             effect->current_technique = technique;
+            if (effect->runtime->shared->lazy != NULL)
+                loadtechnique(effect, i);
             return;
         } // if
     } // for
@@ -1673,6 +3060,69 @@ void MOJOSHADER_effectSetTechnique(MOJOSHADER_effect *effect,
 } // MOJOSHADER_effectSetTechnique
 
 
+void MOJOSHADER_effectPrewarmTechnique(MOJOSHADER_effect *effect,
+                                       const MOJOSHADER_effectTechnique *technique)
+{
+    const MOJOSHADER_effectRuntime *runtime = effect->runtime;
+    const PassPlan *plan;
+    int i, j;
+
+    if ((runtime == NULL) || (runtime->shared->lazy == NULL))
+        return;  // everything was compiled at load time.
+
+    mutex_lock(runtime->shared->lock);
+    for (i = 0; i < effect->technique_count; i++)
+    {
+        if ((technique != NULL) && (technique != &effect->techniques[i]))
+            continue;
+        plan = runtime->pass_plans[i];
+        for (j = 0; j < effect->techniques[i].pass_count; j++, plan++)
+        {
+            queuepassshader(effect, plan->vertex);
+            queuepassshader(effect, plan->pixel);
+        } // for
+    } // for
+    mutex_unlock(runtime->shared->lock);
+} // MOJOSHADER_effectPrewarmTechnique
+
+
+unsigned int MOJOSHADER_effectPrewarmStep(MOJOSHADER_effect *effect,
+                                          unsigned int maxcompiles)
+{
+    MOJOSHADER_effectShared *shared;
+    unsigned int retval;
+    uint32 index;
+    int compiled;
+
+    if (effect->runtime == NULL)
+        return 0;  // one of the static error effects.
+    shared = effect->runtime->shared;
+    if (shared->lazy == NULL)
+        return 0;
+
+    // Clones share the queue, so take one entry at a time; the compile
+    //  itself locks, too, and might take a while.
+    mutex_lock(shared->lock);
+    while ((maxcompiles > 0) && (shared->prewarm_head < shared->prewarm_tail))
+    {
+        index = shared->prewarm[shared->prewarm_head++];
+        // A pass may have needed it since it was queued; that's free.
+        compiled = (shared->lazy[index].shader.shader != NULL);
+        mutex_unlock(shared->lock);
+        if (!compiled)
+        {
+            compilelazyshader(effect, index);
+            maxcompiles--;
+        } // if
+        mutex_lock(shared->lock);
+    } // while
+    retval = shared->prewarm_tail - shared->prewarm_head;
+    mutex_unlock(shared->lock);
+
+    return retval;
+} // MOJOSHADER_effectPrewarmStep
+
+
 const MOJOSHADER_effectTechnique *MOJOSHADER_effectFindNextValidTechnique(const MOJOSHADER_effect *effect,
                                                                           const MOJOSHADER_effectTechnique *technique
 )
@@ -1715,12 +3165,10 @@ void MOJOSHADER_effectBegin(MOJOSHADER_effect *effect,
 void MOJOSHADER_effectBeginPass(MOJOSHADER_effect *effect,
                                 unsigned int pass)
 {
-    int i;
+    PassPlan *plan;
     MOJOSHADER_effectPass *curPass;
-    MOJOSHADER_effectState *state;
     MOJOSHADER_effectShader *rawVert = effect->current_vert_raw;
     MOJOSHADER_effectShader *rawPixl = effect->current_pixl_raw;
-    int has_preshader = 0;
 
     effect->ctx.getBoundShaders(effect->ctx.shaderContext,
                                 &effect->current_vert,
@@ -1729,28 +3177,26 @@ void MOJOSHADER_effectBeginPass(MOJOSHADER_effect *effect,
     assert(effect->current_pass == -1);
     effect->current_pass = pass;
     curPass = &effect->current_technique->passes[pass];
+    plan = &effect->runtime->pass_plans[effect->current_technique - effect->techniques][pass];
 
-    // !!! FIXME: I bet this could be stored at parse/compile time. -flibit
-    for (i = 0; i < curPass->state_count; i++)
+    if (plan->vertex != NULL)
     {
-        state = &curPass->states[i];
-        if (state->type == MOJOSHADER_RS_VERTEXSHADER)
+        rawVert = plan->vertex;
+        if (!rawVert->is_preshader)
         {
-            rawVert = &effect->objects[*state->value.valuesI].shader;
-            if (rawVert->is_preshader)
-                has_preshader = 1;
-            else
-                effect->current_vert = rawVert->shader;
+            loadshader(effect, rawVert);
+            effect->current_vert = rawVert->shader;
         } // if
-        else if (state->type == MOJOSHADER_RS_PIXELSHADER)
+    } // if
+    if (plan->pixel != NULL)
+    {
+        rawPixl = plan->pixel;
+        if (!rawPixl->is_preshader)
         {
-            rawPixl = &effect->objects[*state->value.valuesI].shader;
-            if (rawPixl->is_preshader)
-                has_preshader = 1;
-            else
-                effect->current_pixl = rawPixl->shader;
-        }
-    } // for
+            loadshader(effect, rawPixl);
+            effect->current_pixl = rawPixl->shader;
+        } // if
+    } // if
 
     effect->state_changes->render_state_changes = curPass->states;
     effect->state_changes->render_state_change_count = curPass->state_count;
@@ -1758,37 +3204,58 @@ void MOJOSHADER_effectBeginPass(MOJOSHADER_effect *effect,
     effect->current_vert_raw = rawVert;
     effect->current_pixl_raw = rawPixl;
 
+    // Something else may have used the registers since our last pass.
+    effect->runtime->committed_vert_raw = NULL;
+    effect->runtime->committed_pixl_raw = NULL;
+
     /* If this effect pass has an array of shaders, we get to wait until
      * CommitChanges to actually bind the final shaders.
      * -flibit
      */
-    if (!has_preshader)
+    if (!plan->has_preshader)
     {
         effect->ctx.bindShaders(effect->ctx.shaderContext,
                                 effect->current_vert,
                                 effect->current_pixl);
-        if (effect->current_vert_raw != NULL)
+        if (!plan->samplers_planned)
+            planpasssamplers(plan);
+        if (plan->vertex != NULL)
+        {
+            effect->state_changes->vertex_sampler_state_changes = plan->vertex_samplers;
+            effect->state_changes->vertex_sampler_state_change_count = plan->vertex_sampler_count;
+        } // if
+        else if (rawVert != NULL)
         {
+            // The pass keeps whatever vertex shader was already current.
             effect->state_changes->vertex_sampler_state_changes = rawVert->samplers;
             effect->state_changes->vertex_sampler_state_change_count = rawVert->sampler_count;
+        } // else if
+        if (plan->pixel != NULL)
+        {
+            effect->state_changes->sampler_state_changes = plan->pixel_samplers;
+            effect->state_changes->sampler_state_change_count = plan->pixel_sampler_count;
         } // if
-        if (effect->current_pixl_raw != NULL)
+        else if (rawPixl != NULL)
         {
             effect->state_changes->sampler_state_changes = rawPixl->samplers;
             effect->state_changes->sampler_state_change_count = rawPixl->sampler_count;
-        } // if
+        } // else if
     } // if
 
     MOJOSHADER_effectCommitChanges(effect);
 } // MOJOSHADER_effectBeginPass
 
 
-static inline void copy_parameter_data(MOJOSHADER_effectParam *params,
+/* Compares a parameter to its copy, the first time each commit asks */
+static inline void copy_parameter_data(MOJOSHADER_effect *effect,
                                        unsigned int *param_loc,
                                        MOJOSHADER_symbol *symbols,
                                        unsigned int symbol_count,
-                                       float *regf, int *regi, uint8 *regb)
+                                       float *regf, int *regi, uint8 *regb,
+                                       int dirty_only)
 {
+    const MOJOSHADER_effectParam *params = effect->params;
+    const uint8 *dirty = effect->runtime->param_dirty;
     int i, j, r, c;
 
     i = 0;
@@ -1797,6 +3264,9 @@ static inline void copy_parameter_data(MOJOSHADER_effectParam *params,
         const MOJOSHADER_symbol *sym = &symbols[i];
         const MOJOSHADER_effectValue *param = &params[param_loc[i]].value;
 
+        if (dirty_only && !dirty[param_loc[i]])
+            continue;
+
         // float/int registers are vec4, so they have 4 elements each
         const uint32 start = sym->register_index << 2;
 
@@ -1844,8 +3314,77 @@ static inline void copy_parameter_data(MOJOSHADER_effectParam *params,
 } // copy_parameter_data
 
 
+static inline int any_parameter_dirty(MOJOSHADER_effect *effect,
+                                      const unsigned int *param_loc,
+                                      unsigned int count)
+{
+    const uint8 *dirty = effect->runtime->param_dirty;
+    unsigned int i;
+    for (i = 0; i < count; i++)
+        if (dirty[param_loc[i]])
+            return 1;
+    return 0;
+} // any_parameter_dirty
+
+
+static inline PreshaderMemo *preshader_memo(MOJOSHADER_effect *effect,
+                                            MOJOSHADER_effectShader *raw)
+{
+    // The shader is the first thing in its object, so this finds its index.
+    const MOJOSHADER_effectObject *object = (const MOJOSHADER_effectObject *) raw;
+    return &effect->runtime->preshader_memos[object - effect->objects];
+} // preshader_memo
+
+
+static int preshader_memo_hit(MOJOSHADER_effect *effect,
+                              PreshaderMemo *memo,
+                              const unsigned int *param_loc)
+{
+    MOJOSHADER_effectRuntime *runtime = effect->runtime;
+    unsigned int i;
+    int hit = memo->valid;
+
+    if (!runtime->track_changes)
+    {
+        memo->valid = 0;
+        runtime->preshader_misses++;
+        return 0;
+    } // if
+
+    // Either way, the memo describes these inputs once the caller is done.
+    for (i = 0; i < memo->input_count; i++)
+    {
+        const uint32 version = runtime->param_versions[param_loc[i]];
+        if (memo->versions[i] != version)
+        {
+            memo->versions[i] = version;
+            hit = 0;
+        } // if
+    } // for
+    memo->valid = 1;
+
+    if (hit)
+        runtime->preshader_hits++;
+    else
+        runtime->preshader_misses++;
+    return hit;
+} // preshader_memo_hit
+
+
+static inline void run_preshader(const PreshaderMemo *memo,
+                                 const MOJOSHADER_preshader *preshader,
+                                 float *outregs)
+{
+    if (memo->program != NULL)
+        runpreshaderprogram(memo->program, outregs);
+    else
+        MOJOSHADER_runPreshader(preshader, outregs);
+} // run_preshader
+
+
 void MOJOSHADER_effectCommitChanges(MOJOSHADER_effect *effect)
 {
+    MOJOSHADER_effectRuntime *runtime = effect->runtime;
     MOJOSHADER_effectShader *rawVert = effect->current_vert_raw;
     MOJOSHADER_effectShader *rawPixl = effect->current_pixl_raw;
 
@@ -1856,6 +3395,8 @@ void MOJOSHADER_effectCommitChanges(MOJOSHADER_effect *effect)
     float selector;
     int shader_object;
     int selector_ran = 0;
+    int dirty_only;
+    PreshaderMemo *memo;
 
     float *vs_reg_file_f, *ps_reg_file_f;
     int *vs_reg_file_i, *ps_reg_file_i;
@@ -1865,22 +3406,29 @@ void MOJOSHADER_effectCommitChanges(MOJOSHADER_effect *effect)
      * that determines which shader to use, based on a parameter's value.
      * -flibit
      */
-    // !!! FIXME: We're just running the preshaders every time. Blech. -flibit
     #define SELECT_SHADER_FROM_PRESHADER(raw, gls) \
         if (raw != NULL && raw->is_preshader) \
         { \
-            i = 0; \
-            do \
+            memo = preshader_memo(effect, raw); \
+            if (preshader_memo_hit(effect, memo, raw->preshader_params)) \
+                selector = memo->selector; \
+            else \
             { \
-                param = &effect->params[raw->preshader_params[i]].value; \
-                for (j = 0; j < (param->value_count >> 2); j++) \
-                    memcpy(raw->preshader->registers + raw->preshader->symbols[i].register_index + j, \
-                           param->valuesI + (j << 2), \
-                           param->type.columns << 2); \
-            } while (++i < raw->preshader->symbol_count); \
-            MOJOSHADER_runPreshader(raw->preshader, &selector); \
+                i = 0; \
+                do \
+                { \
+                    param = &effect->params[raw->preshader_params[i]].value; \
+                    for (j = 0; j < (param->value_count >> 2); j++) \
+                        memcpy(raw->preshader->registers + raw->preshader->symbols[i].register_index + j, \
+                               param->valuesI + (j << 2), \
+                               param->type.columns << 2); \
+                } while (++i < raw->preshader->symbol_count); \
+                run_preshader(memo, raw->preshader, &selector); \
+                memo->selector = selector; \
+            } \
             shader_object = effect->params[raw->params[0]].value.valuesI[(int) selector]; \
             raw = &effect->objects[shader_object].shader; \
+            loadshader(effect, raw); \
             gls = raw->shader; \
             selector_ran = 1; \
         }
@@ -1909,37 +3457,63 @@ void MOJOSHADER_effectCommitChanges(MOJOSHADER_effect *effect)
      * the copy_parameter_data() and MOJOSHADER_runPreshader() functions.
      * -flibit
      */
-    // !!! FIXME: We're just copying everything every time. Blech. -flibit
-    // !!! FIXME: We're just running the preshaders every time. Blech. -flibit
     // !!! FIXME: Will the preshader ever want int/bool registers? -flibit
-    #define COPY_PARAMETER_DATA(raw, stage) \
+    #define COPY_PARAMETER_DATA(raw, committed, stage) \
         if (raw != NULL && raw->shader != NULL) \
         { \
+            dirty_only = (runtime->track_changes && raw == committed); \
             pd = effect->ctx.getParseData(raw->shader); \
-            copy_parameter_data(effect->params, raw->params, \
+            copy_parameter_data(effect, raw->params, \
                                 pd->symbols, \
                                 pd->symbol_count, \
                                 stage##_reg_file_f, \
                                 stage##_reg_file_i, \
-                                stage##_reg_file_b); \
-            if (pd->preshader) \
+                                stage##_reg_file_b, \
+                                dirty_only); \
+            if (pd->preshader && (!dirty_only \
+             || any_parameter_dirty(effect, raw->preshader_params, \
+                                    pd->preshader->symbol_count))) \
             { \
-                copy_parameter_data(effect->params, raw->preshader_params, \
-                                    pd->preshader->symbols, \
-                                    pd->preshader->symbol_count, \
-                                    pd->preshader->registers, \
-                                    NULL, \
-                                    NULL); \
-                MOJOSHADER_runPreshader(pd->preshader, stage##_reg_file_f); \
+                memo = preshader_memo(effect, raw); \
+                if (preshader_memo_hit(effect, memo, raw->preshader_params)) \
+                { \
+                    for (i = 0; i < memo->output_count; i++) \
+                        stage##_reg_file_f[memo->output_index[i]] = memo->outputs[i]; \
+                } \
+                else \
+                { \
+                    copy_parameter_data(effect, raw->preshader_params, \
+                                        pd->preshader->symbols, \
+                                        pd->preshader->symbol_count, \
+                                        pd->preshader->registers, \
+                                        NULL, \
+                                        NULL, \
+                                        0); \
+                    run_preshader(memo, pd->preshader, stage##_reg_file_f); \
+                    for (i = 0; i < memo->output_count; i++) \
+                        memo->outputs[i] = stage##_reg_file_f[memo->output_index[i]]; \
+                } \
             } \
         }
     effect->ctx.mapUniformBufferMemory(effect->ctx.shaderContext,
                                        &vs_reg_file_f, &vs_reg_file_i, &vs_reg_file_b,
                                        &ps_reg_file_f, &ps_reg_file_i, &ps_reg_file_b);
-    COPY_PARAMETER_DATA(rawVert, vs)
-    COPY_PARAMETER_DATA(rawPixl, ps)
+    COPY_PARAMETER_DATA(rawVert, runtime->committed_vert_raw, vs)
+    COPY_PARAMETER_DATA(rawPixl, runtime->committed_pixl_raw, ps)
     effect->ctx.unmapUniformBufferMemory(effect->ctx.shaderContext);
     #undef COPY_PARAMETER_DATA
+
+    /* Both stages are up to date now, so the next commit only needs to copy
+     * what gets set before then.
+     */
+    if (runtime->track_changes)
+    {
+        runtime->committed_vert_raw = rawVert;
+        runtime->committed_pixl_raw = rawPixl;
+        for (i = 0; i < runtime->dirty_count; i++)
+            runtime->param_dirty[runtime->dirty_params[i]] = 0;
+        runtime->dirty_count = 0;
+    } // if
 } // MOJOSHADER_effectCommitChanges
 
 
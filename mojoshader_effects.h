@@ -519,6 +519,12 @@ typedef const char* (MOJOSHADERCALL * MOJOSHADER_getErrorFunc)(
     const void *ctx
 );
 
+/* Optional, see MOJOSHADER_compileEffectThreaded() */
+typedef void* (MOJOSHADERCALL * MOJOSHADER_compileParsedShaderFunc)(
+    const void *ctx,
+    const MOJOSHADER_parseData *pd
+);
+
 typedef struct MOJOSHADER_effectShaderContext
 {
     /* Shader Backend */
@@ -542,6 +548,12 @@ typedef struct MOJOSHADER_effectShaderContext
 } MOJOSHADER_effectShaderContext;
 
 
+/*
+ * Everything an effect keeps for itself at runtime. This is opaque; only
+ *  the effect functions look inside.
+ */
+typedef struct MOJOSHADER_effectRuntime MOJOSHADER_effectRuntime;
+
 /*
  * Structure used to return data from parsing of an effect file...
  */
@@ -649,6 +661,13 @@ typedef struct MOJOSHADER_effect
      * This is the shader implementation you passed to MOJOSHADER_compileEffect().
      */
     MOJOSHADER_effectShaderContext ctx;
+
+    /*
+     * Pass plans, change tracking, preshader memos, and what this effect
+     *  shares with its clones. This is NULL for the effects returned on
+     *  errors.
+     */
+    MOJOSHADER_effectRuntime *runtime;
 } MOJOSHADER_effect;
 
 
@@ -676,6 +695,93 @@ DECLSPEC MOJOSHADER_effect *MOJOSHADER_compileEffect(const unsigned char *tokenb
                                                      const unsigned int smapcount,
                                                      const MOJOSHADER_effectShaderContext *ctx);
 
+/* Like MOJOSHADER_compileEffect(), but each shader is only compiled the
+ *  first time it's needed: when MOJOSHADER_effectSetTechnique() picks a
+ *  technique that uses it, when a pass begins with it, or when a preshader
+ *  picks it from a shader array. MOJOSHADER_effectPrewarmStep() can also
+ *  compile shaders ahead of time.
+ *
+ * The shader bytecode is copied, so (tokenbuf) may go away after this call.
+ *  Otherwise the arguments are the same as MOJOSHADER_compileEffect().
+ *
+ * Loading an effect with lots of techniques the app never uses this way
+ *  skips compiling their shaders at all. Clones share the compiled shaders,
+ *  so each one is still only compiled once.
+ *
+ * Since shaders compile later, their errors show up later, too: a shader
+ *  that fails to compile is left NULL in its pass, and the backend's
+ *  getError reports why.
+ *
+ * This call is only as thread safe as the backend functions!
+ */
+DECLSPEC MOJOSHADER_effect *MOJOSHADER_compileEffectLazy(const unsigned char *tokenbuf,
+                                                         const unsigned int bufsize,
+                                                         const MOJOSHADER_swizzle *swiz,
+                                                         const unsigned int swizcount,
+                                                         const MOJOSHADER_samplerMap *smap,
+                                                         const unsigned int smapcount,
+                                                         const MOJOSHADER_effectShaderContext *ctx);
+
+/* Like MOJOSHADER_compileEffectLazy(), but without copying any of the
+ *  shader bytecode.
+ *
+ *   (tokenbuf) is a buffer of Direct3D effect bytecode, usually a memory-mapped
+ *   file. It is NOT copied; shader bytecode is read from it later, so it must
+ *   stay valid and unchanged until this effect and all of its clones are
+ *   deleted.
+ *   The other arguments are the same as MOJOSHADER_compileEffect(). (swiz) and
+ *   (smap) are copied, so those may go away after this call.
+ *
+ * This call is only as thread safe as the backend functions!
+ */
+DECLSPEC MOJOSHADER_effect *MOJOSHADER_compileEffectMapped(const unsigned char *tokenbuf,
+                                                           const unsigned int bufsize,
+                                                           const MOJOSHADER_swizzle *swiz,
+                                                           const unsigned int swizcount,
+                                                           const MOJOSHADER_samplerMap *smap,
+                                                           const unsigned int smapcount,
+                                                           const MOJOSHADER_effectShaderContext *ctx);
+
+/* Like MOJOSHADER_compileEffect(), but the shaders are translated on
+ *  several threads at once.
+ *
+ * Normally each shader object goes through (ctx)'s compileShader in turn,
+ *  which translates the bytecode with MOJOSHADER_parse() and then does
+ *  whatever the backend needs on top. Here, every shader object is first
+ *  translated with MOJOSHADER_parseBatch(), and then the results are handed
+ *  to (compileParsedShader) one at a time, on the calling thread, for the
+ *  backend's part.
+ *
+ *   (profile) is the profile to translate to, the same one the backend
+ *   would pass to MOJOSHADER_parse().
+ *   (compileParsedShader) does the same thing as (ctx)'s compileShader,
+ *   starting from a translated shader. It takes ownership of the parse
+ *   data, even if it fails, and returns NULL on failure like compileShader.
+ *   (threadcount) is the most threads to use, including the calling
+ *   thread. Zero means one per CPU core. See MOJOSHADER_parseBatch().
+ *   The other arguments are the same as MOJOSHADER_compileEffect(), except
+ *   that (ctx)'s allocator must be safe to call from several threads at
+ *   once.
+ *
+ * If (profile) or (compileParsedShader) is NULL, this is the same as
+ *  MOJOSHADER_compileEffect().
+ *
+ * The resulting effect is the same as MOJOSHADER_compileEffect() would give,
+ *  and is used and deleted the same way.
+ *
+ * This call is only as thread safe as the backend functions!
+ */
+DECLSPEC MOJOSHADER_effect *MOJOSHADER_compileEffectThreaded(const unsigned char *tokenbuf,
+                                                             const unsigned int bufsize,
+                                                             const MOJOSHADER_swizzle *swiz,
+                                                             const unsigned int swizcount,
+                                                             const MOJOSHADER_samplerMap *smap,
+                                                             const unsigned int smapcount,
+                                                             const MOJOSHADER_effectShaderContext *ctx,
+                                                             const char *profile,
+                                                             MOJOSHADER_compileParsedShaderFunc compileParsedShader,
+                                                             const unsigned int threadcount);
+
 /* Delete the shaders that were allocated for an effect.
  *
  * (effect) is a MOJOSHADER_effect* obtained from MOJOSHADER_compileEffect().
@@ -691,6 +797,11 @@ DECLSPEC void MOJOSHADER_deleteEffect(const MOJOSHADER_effect *effect);
  * This function returns a MOJOSHADER_effect*, containing effect data which
  *  includes shaders usable with the provided backend.
  *
+ * Only parameter values and per-effect state are copied. Everything else
+ *  (errors, techniques, passes, states, annotations, names and types,
+ *  preshader code) is shared with (effect), so treat it as read-only; it
+ *  lives until the last of (effect) and its clones is deleted, in any order.
+ *
  * This call is only as thread safe as the backend functions!
  */
 DECLSPEC MOJOSHADER_effect *MOJOSHADER_cloneEffect(const MOJOSHADER_effect *effect);
@@ -716,7 +827,9 @@ DECLSPEC void MOJOSHADER_effectSetRawValueHandle(const MOJOSHADER_effectParam *p
 
 /* Set the constant value for the effect parameter, specified by name.
  *  Note: this function is slower than MOJOSHADER_effectSetRawValueHandle(),
- *  but we still provide it to fully map to ID3DXEffect.
+ *  but we still provide it to fully map to ID3DXEffect. Names are hashed,
+ *  but if you set a parameter often, look it up once with
+ *  MOJOSHADER_effectGetParameterByName() and keep the handle.
  *
  * This function maps to ID3DXEffect::SetRawValue.
  *
@@ -734,6 +847,64 @@ DECLSPEC void MOJOSHADER_effectSetRawValueName(const MOJOSHADER_effect *effect,
                                                const unsigned int offset,
                                                const unsigned int len);
 
+/* Find a top-level effect parameter by name.
+ *
+ * This function maps to ID3DXEffect::GetParameterByName, with a NULL parent.
+ *
+ * (effect) is a MOJOSHADER_effect* obtained from MOJOSHADER_compileEffect().
+ * (name) is the human-readable name of the parameter to find.
+ *
+ * Returns the parameter, for MOJOSHADER_effectSetRawValueHandle(), or NULL
+ *  if (effect) has no parameter called (name). The handle stays valid until
+ *  (effect) is deleted; it's not valid for clones of (effect).
+ *
+ * This function is thread safe.
+ */
+DECLSPEC const MOJOSHADER_effectParam *MOJOSHADER_effectGetParameterByName(const MOJOSHADER_effect *effect,
+                                                                           const char *name);
+
+
+/* Only copy changed parameters when committing changes to an effect.
+ *
+ * By default, MOJOSHADER_effectCommitChanges() copies every parameter used
+ *  by the bound shaders. Once tracking is enabled, the
+ *  MOJOSHADER_effectSetRawValue* functions mark the parameters they write,
+ *  and only marked parameters are copied again. Writing to a parameter's
+ *  (value.values) directly is NOT seen, so apps that do that must leave
+ *  tracking off. If there isn't enough memory for the marks, tracking
+ *  stays off.
+ *
+ * Everything is still copied when a pass begins or a preshader picks a new
+ *  shader, so other effects using the same registers are not a problem.
+ *  Setting uniforms through the backend in the middle of a pass is.
+ *
+ * (effect) is a MOJOSHADER_effect* obtained from MOJOSHADER_compileEffect().
+ * (enable) is nonzero to track changes, zero to go back to copying
+ *  everything.
+ *
+ * This function is thread safe.
+ */
+DECLSPEC void MOJOSHADER_effectTrackChanges(MOJOSHADER_effect *effect,
+                                            int enable);
+
+/* Find out how often an effect's preshaders actually had to run.
+ *
+ * While tracking changes (see MOJOSHADER_effectTrackChanges()), a preshader
+ *  whose input parameters haven't changed since its last run reuses that
+ *  run's results instead. This counts both outcomes over the life of the
+ *  effect; sample it once per frame and subtract to get a rate. Without
+ *  tracking, every run counts as a miss.
+ *
+ * (effect) is a MOJOSHADER_effect* obtained from MOJOSHADER_compileEffect().
+ * (hits) is filled with the number of preshader runs that were skipped.
+ * (misses) is filled with the number of preshader runs that happened.
+ *
+ * This function is thread safe.
+ */
+DECLSPEC void MOJOSHADER_effectGetPreshaderStats(const MOJOSHADER_effect *effect,
+                                                 unsigned int *hits,
+                                                 unsigned int *misses);
+
 
 /* Effect technique interface... */
 
@@ -756,11 +927,52 @@ DECLSPEC const MOJOSHADER_effectTechnique *MOJOSHADER_effectGetCurrentTechnique(
  * (effect) is a MOJOSHADER_effect* obtained from MOJOSHADER_compileEffect().
  * (technique) is the technique to be used by the effect when rendered.
  *
- * This function is thread safe.
+ * For effects from MOJOSHADER_compileEffectLazy() or
+ *  MOJOSHADER_compileEffectMapped(), this compiles any shaders the
+ *  technique's passes use that haven't been compiled yet.
+ *
+ * This function is thread safe, unless it has shaders to compile; then it's
+ *  only as thread safe as the backend functions!
  */
 DECLSPEC void MOJOSHADER_effectSetTechnique(MOJOSHADER_effect *effect,
                                             const MOJOSHADER_effectTechnique *technique);
 
+/* Queue a technique's shaders to be compiled by MOJOSHADER_effectPrewarmStep().
+ *
+ * (effect) is a MOJOSHADER_effect* obtained from
+ *  MOJOSHADER_compileEffectLazy() or MOJOSHADER_compileEffectMapped(). Other
+ *  effects already have all their shaders, so this does nothing for them.
+ * (technique) is a technique in the given effect, or NULL to queue every
+ *  technique's shaders. Shaders that are compiled or queued already are
+ *  skipped. The queue is shared with the effect's clones.
+ *
+ * This function is thread safe. Clones may queue and compile shaders on
+ *  different threads.
+ */
+DECLSPEC void MOJOSHADER_effectPrewarmTechnique(MOJOSHADER_effect *effect,
+                                                const MOJOSHADER_effectTechnique *technique);
+
+/* Compile some of the shaders queued by MOJOSHADER_effectPrewarmTechnique().
+ *
+ * Backends can usually only compile shaders on the thread that owns their
+ *  context, so rather than compiling in the background, the app calls this
+ *  when it has time to spare: a few shaders per frame on a loading screen,
+ *  say.
+ *
+ * (effect) is a MOJOSHADER_effect* obtained from
+ *  MOJOSHADER_compileEffectLazy() or MOJOSHADER_compileEffectMapped().
+ * (maxcompiles) is the most shaders to compile during this call.
+ *
+ * This function returns the number of shaders still queued, so it returns
+ *  zero once the queue is drained.
+ *
+ * This call is only as thread safe as the backend functions! An effect
+ *  and its clones only compile one shader at a time, even from different
+ *  threads, but each compile runs on whichever thread asked for it.
+ */
+DECLSPEC unsigned int MOJOSHADER_effectPrewarmStep(MOJOSHADER_effect *effect,
+                                                   unsigned int maxcompiles);
+
 /* Get the next technique in an effect's list.
  *
  * This function maps to ID3DXEffect::FindNextValidTechnique.
@@ -444,12 +444,61 @@ int buffer_append_va(Buffer *buffer, const char *fmt, va_list va);
 size_t buffer_size(Buffer *buffer);
 void buffer_empty(Buffer *buffer);
 char *buffer_flatten(Buffer *buffer);
-char *buffer_merge(Buffer **buffers, const size_t n, size_t *_len);
+char *buffer_merge(Buffer **buffers, const size_t n, size_t *_len,
+                   MOJOSHADER_malloc m, void *d);
 void buffer_destroy(Buffer *buffer);
 void buffer_patch(Buffer *buffer, const size_t start,
                   const void *data, const size_t len);
 
 
+// Arena allocator...
+
+// Memory that all dies at the same time can come from an arena: it hands
+//  out pieces of big blocks, and arena_destroy() frees the blocks. There is
+//  no way to free an individual allocation.
+typedef struct ArenaBlock
+{
+    struct ArenaBlock *next;
+    size_t used;
+    size_t bytes;
+} ArenaBlock;
+typedef struct Arena
+{
+    ArenaBlock *head;
+    size_t block_size;
+    size_t allocations;  // number of arena_alloc() calls that succeeded.
+    size_t blocks;  // number of blocks allocated from (m).
+    MOJOSHADER_malloc m;
+    MOJOSHADER_free f;
+    void *d;
+} Arena;
+void arena_init(Arena *arena, size_t blksz,
+                MOJOSHADER_malloc m, MOJOSHADER_free f, void *d);
+void *arena_alloc(Arena *arena, const size_t len);
+void arena_destroy(Arena *arena);
+
+
+// Threads...
+
+// These are only as much threading as MojoShader needs internally: start a
+//  thread, wait for it, a lock, and an atomic counter. If the platform (or
+//  build) has no threads, thread_create() and mutex_create() return NULL and
+//  everything else quietly does nothing, so callers must be prepared to do
+//  the work on the calling thread instead.
+typedef int (*ThreadFn)(void *data);
+typedef struct Thread Thread;
+Thread *thread_create(ThreadFn fn, void *data,
+                      MOJOSHADER_malloc m, MOJOSHADER_free f, void *d);
+int thread_wait(Thread *thread);  // returns (fn)'s return value, frees thread.
+typedef struct Mutex Mutex;
+Mutex *mutex_create(MOJOSHADER_malloc m, MOJOSHADER_free f, void *d);
+void mutex_lock(Mutex *mutex);
+void mutex_unlock(Mutex *mutex);
+void mutex_destroy(Mutex *mutex);
+int atomic_add(volatile int *value, const int amount);  // returns old value.
+int cpu_count(void);
+
+
 
 // This is the ID for a D3DXSHADER_CONSTANTTABLE in the bytecode comments.
 #define CTAB_ID 0x42415443  // 0x42415443 == 'CTAB'
@@ -727,16 +776,39 @@ typedef struct Conditional
     struct Conditional *next;
 } Conditional;
 
+// A #define's replacement list, lexed once when the macro is defined, so
+//  expanding it doesn't have to run the lexer over the text again.
+typedef struct MacroToken
+{
+    Token tokenval;
+    const char *token;
+    unsigned int tokenlen;
+    int param;  // index into Define::parameters, -1 if not a parameter.
+} MacroToken;
+
 typedef struct Define
 {
     const char *identifier;
+    unsigned int identifier_len;
+    uint32 identifier_hash;
     const char *definition;
-    const char *original;
     const char **parameters;
     int paramcount;
+    MacroToken *tokens;
+    unsigned int tokencount;
     struct Define *next;
 } Define;
 
+// Tracks whether an #included file is wrapped in a classic multiple-inclusion
+//  guard, so the preprocessor can skip opening it again.
+typedef enum
+{
+    INCLUDE_GUARD_NONE,    // not a candidate (anymore).
+    INCLUDE_GUARD_START,   // just #included, haven't seen anything yet.
+    INCLUDE_GUARD_INSIDE,  // first thing was "#ifndef X", until its #endif.
+    INCLUDE_GUARD_CLOSED   // ...and after it, where anything but EOI spoils it.
+} IncludeGuardState;
+
 typedef struct IncludeState
 {
     const char *filename;
@@ -753,7 +825,15 @@ typedef struct IncludeState
     unsigned int orig_length;
     unsigned int bytes_left;
     unsigned int line;
+    const MacroToken *macro_tokens;  // non-NULL if replaying a #define.
+    unsigned int macro_tokencount;
+    unsigned int macro_tokenpos;
     Conditional *conditional_stack;
+    IncludeGuardState guard_state;
+    const char *guard_key;  // what include_key() called this file.
+    const char *guard_macro;  // points into source_base.
+    unsigned int guard_macrolen;
+    const Conditional *guard_conditional;
     MOJOSHADER_includeClose close_callback;
     struct IncludeState *next;
 } IncludeState;
@@ -766,6 +846,7 @@ Preprocessor *preprocessor_start(const char *fname, const char *source,
                             unsigned int sourcelen,
                             MOJOSHADER_includeOpen open_callback,
                             MOJOSHADER_includeClose close_callback,
+                            MOJOSHADER_includeCache *include_cache,
                             const MOJOSHADER_preprocessorDefine *defines,
                             unsigned int define_count, int asm_comments,
                             MOJOSHADER_malloc m, MOJOSHADER_free f, void *d);
@@ -32,7 +32,15 @@ typedef unsigned char uchar;
 #define YYCURSOR cursor
 #define YYLIMIT limit
 #define YYMARKER s->lexer_marker
-#define YYFILL(n) { if ((n) == 1) { cursor = sentinel; limit = cursor + YYMAXFILL; eoi = 1; } }
+// If we've already run through the sentinel, we're in a string or char
+//  literal that never ended (nothing else matches a run of nulls), so
+//  give up on it instead of scanning the sentinel forever.
+#define YYFILL(n) { \
+    if ((n) == 1) { \
+        if (limit == sentinel + YYMAXFILL) { RET(TOKEN_BAD_CHARS); } \
+        cursor = sentinel; limit = cursor + YYMAXFILL; eoi = 1; \
+    } \
+}
 
 static uchar sentinel[YYMAXFILL];
 
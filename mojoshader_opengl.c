@@ -64,6 +64,20 @@ typedef void (APIENTRYP PFNGLSPECIALIZESHADERARBPROC) (
 );
 #endif
 
+#ifdef MOJOSHADER_GLSL_UNIFORM_BUFFERS
+#ifndef GL_ARB_buffer_storage
+#define GL_ARB_buffer_storage 1
+#define GL_MAP_PERSISTENT_BIT 0x0040
+#define GL_MAP_COHERENT_BIT 0x0080
+typedef void (APIENTRYP PFNGLBUFFERSTORAGEPROC) (
+    GLenum target,
+    GLsizeiptr size,
+    const void *data,
+    GLbitfield flags
+);
+#endif
+#endif
+
 struct MOJOSHADER_glShader
 {
     const MOJOSHADER_parseData *parseData;
@@ -84,6 +98,54 @@ typedef struct
     GLint location;
 } AttributeMap;
 
+// The register files, as far as uniform uploads are concerned. All but the
+//  last line up with a program's uniform arrays (vs_uniforms_float4, etc).
+typedef enum
+{
+    REGFILE_VS_FLOAT4,
+    REGFILE_VS_INT4,
+    REGFILE_VS_BOOL,
+    REGFILE_PS_FLOAT4,
+    REGFILE_PS_INT4,
+    REGFILE_PS_BOOL,
+    REGFILE_TEXBEM,
+    REGFILE_TOTAL
+} RegisterFile;
+
+#define UNIFORM_ARRAY_TOTAL REGFILE_TEXBEM
+
+// A run of registers that a program keeps at (offset) in one of its uniform
+//  arrays. Spans are sorted by (first); (reach) is the furthest any span up
+//  to and including this one extends, so we can binary search them even if
+//  an array overlaps other uniforms.
+typedef struct
+{
+    uint32 first;
+    uint32 count;
+    uint32 offset;
+    uint32 reach;
+} RegisterSpan;
+
+// Registers [start, end) of a register file changed at (generation).
+typedef struct
+{
+    uint32 generation;
+    RegisterFile file;
+    uint32 start;
+    uint32 end;
+} DirtyRange;
+
+#ifdef MOJOSHADER_GLSL_UNIFORM_BUFFERS
+// A program's float4 array, as last written to the uniform ring. The bytes
+//  stay put until the ring comes back around to (serial)'s segment.
+typedef struct
+{
+    uint32 serial;
+    GLintptr offset;
+    GLsizeiptr size;  // zero if there's nothing current in the ring.
+} UniformSlice;
+#endif
+
 struct MOJOSHADER_glProgram
 {
     MOJOSHADER_glShader *vertex;
@@ -108,6 +170,21 @@ struct MOJOSHADER_glProgram
     size_t ps_uniforms_bool_count;
     GLint *ps_uniforms_bool;
 
+    // Where each register file lives in the uniform arrays above, and which
+    //  part of each array needs to go to the GL on the next push.
+    int synced;
+    RegisterSpan *spans[UNIFORM_ARRAY_TOTAL];
+    uint32 span_count[UNIFORM_ARRAY_TOTAL];
+    uint32 dirty_start[UNIFORM_ARRAY_TOTAL];
+    uint32 dirty_end[UNIFORM_ARRAY_TOTAL];
+    GLint *element_loc[UNIFORM_ARRAY_TOTAL];  // GLSL only, filled on demand.
+
+#ifdef MOJOSHADER_GLSL_UNIFORM_BUFFERS
+    // GLSL only: which stages keep their float4 array in a uniform block.
+    int uses_uniform_block[2];
+    UniformSlice uniform_slice[2];
+#endif
+
     uint32 refcount;
 
     int uses_pointsize;
@@ -154,6 +231,18 @@ typedef WINGDIAPI void (APIENTRYP PFNGLDISABLEPROC) (GLenum cap);
 #define MAX_REG_FILE_I 2047
 #define MAX_REG_FILE_B 2047
 #define MAX_TEXBEMS 3  // ps_1_1 allows 4 texture stages, texbem can't use t0.
+#define DIRTY_LOG_SIZE 64
+
+#ifdef MOJOSHADER_GLSL_UNIFORM_BUFFERS
+// The uniform ring is split into segments, so we only have to fence and
+//  wait on the GPU when we move from one segment to the next. A segment has
+//  to hold the biggest float4 array we could ever upload.
+#define UNIFORM_RING_SEGMENTS 4
+#define UNIFORM_RING_SEGMENT_SIZE (256 * 1024)
+#endif
+
+// One program MOJOSHADER_glBindShaders() linked. See linker_cache below.
+typedef struct LinkerCacheItem LinkerCacheItem;
 
 struct MOJOSHADER_glContext
 {
@@ -177,8 +266,39 @@ struct MOJOSHADER_glContext
     // This increments every time we change the register files.
     uint32 generation;
 
-    // This keeps track of implicitly linked programs.
+    // The most recent changes to the register files, so ProgramReady() can
+    //  update just the registers that changed since a program last synced.
+    //  A program that synced before (dirty_floor) may have missed some of
+    //  them, and has to check everything.
+    DirtyRange dirty_log[DIRTY_LOG_SIZE];
+    uint32 dirty_log_next;
+    uint32 dirty_log_used;
+    uint32 dirty_floor;
+
+#ifdef MOJOSHADER_GLSL_UNIFORM_BUFFERS
+    // Float4 uniform blocks get written here. (uniform_ring_map) is NULL if
+    //  we can't map persistently and have to use glBufferSubData() instead.
+    //  (uniform_ring_serial) counts segments as the ring advances.
+    GLuint uniform_ring;
+    uint8 *uniform_ring_map;
+    GLintptr uniform_ring_head;
+    GLintptr uniform_ring_align;
+    uint32 uniform_ring_serial;
+    GLsync uniform_ring_fence[UNIFORM_RING_SEGMENTS];
+    UniformSlice uniform_ring_bound[2];
+#endif
+
+    // This keeps track of implicitly linked programs. They're also on a
+    //  list, most recently bound first, so the cache can drop the least
+    //  recently bound when it's full. (linker_cache_capacity) is zero for
+    //  no limit.
     HashTable *linker_cache;
+    LinkerCacheItem *linker_lru_head;
+    LinkerCacheItem *linker_lru_tail;
+    uint32 linker_cache_count;
+    uint32 linker_cache_capacity;
+    uint32 live_programs;
+    MOJOSHADER_glLinkerCacheStats linker_stats;
 
     // This tells us which vertex attribute arrays we have enabled.
     GLint max_attrs;
@@ -226,6 +346,11 @@ struct MOJOSHADER_glContext
     int have_GL_ARB_instanced_arrays;
     int have_GL_ARB_ES2_compatibility;
     int have_GL_ARB_gl_spirv;
+#ifdef MOJOSHADER_GLSL_UNIFORM_BUFFERS
+    int have_GL_ARB_uniform_buffer_object;
+    int have_GL_ARB_buffer_storage;
+    int have_GL_ARB_sync;
+#endif
 
     // Entry points...
     PFNGLGETSTRINGPROC glGetString;
@@ -289,6 +414,21 @@ struct MOJOSHADER_glContext
     PFNGLVERTEXATTRIBDIVISORARBPROC glVertexAttribDivisorARB;
     PFNGLSHADERBINARYPROC glShaderBinary;
     PFNGLSPECIALIZESHADERARBPROC glSpecializeShaderARB;
+#ifdef MOJOSHADER_GLSL_UNIFORM_BUFFERS
+    PFNGLGENBUFFERSPROC glGenBuffers;
+    PFNGLDELETEBUFFERSPROC glDeleteBuffers;
+    PFNGLBINDBUFFERPROC glBindBuffer;
+    PFNGLBUFFERDATAPROC glBufferData;
+    PFNGLBUFFERSUBDATAPROC glBufferSubData;
+    PFNGLBINDBUFFERRANGEPROC glBindBufferRange;
+    PFNGLGETUNIFORMBLOCKINDEXPROC glGetUniformBlockIndex;
+    PFNGLUNIFORMBLOCKBINDINGPROC glUniformBlockBinding;
+    PFNGLBUFFERSTORAGEPROC glBufferStorage;
+    PFNGLMAPBUFFERRANGEPROC glMapBufferRange;
+    PFNGLFENCESYNCPROC glFenceSync;
+    PFNGLCLIENTWAITSYNCPROC glClientWaitSync;
+    PFNGLDELETESYNCPROC glDeleteSync;
+#endif
 
     // interface for profile-specific things.
     int (*profileMaxUniforms)(MOJOSHADER_shaderType shader_type);
@@ -414,6 +554,44 @@ static inline void toggle_gl_state(GLenum state, int val)
 } // toggle_gl_state
 
 
+static inline size_t uniform_array_count(const MOJOSHADER_glProgram *program,
+                                         const int array)
+{
+    switch ((RegisterFile) array)
+    {
+        case REGFILE_VS_FLOAT4: return program->vs_uniforms_float4_count;
+        case REGFILE_VS_INT4: return program->vs_uniforms_int4_count;
+        case REGFILE_VS_BOOL: return program->vs_uniforms_bool_count;
+        case REGFILE_PS_FLOAT4: return program->ps_uniforms_float4_count;
+        case REGFILE_PS_INT4: return program->ps_uniforms_int4_count;
+        case REGFILE_PS_BOOL: return program->ps_uniforms_bool_count;
+        default: break;
+    } // switch
+
+    assert(0 && "Unexpected uniform array");
+    return 0;
+} // uniform_array_count
+
+static inline void mark_uniforms_dirty(MOJOSHADER_glProgram *program,
+                                       const int array, const uint32 start,
+                                       const uint32 end)
+{
+    assert(array < UNIFORM_ARRAY_TOTAL);
+    if (program->dirty_start[array] == program->dirty_end[array])
+    {
+        program->dirty_start[array] = start;
+        program->dirty_end[array] = end;
+    } // if
+    else
+    {
+        if (start < program->dirty_start[array])
+            program->dirty_start[array] = start;
+        if (end > program->dirty_end[array])
+            program->dirty_end[array] = end;
+    } // else
+} // mark_uniforms_dirty
+
+
 // profile-specific implementations...
 
 #if SUPPORT_PROFILE_GLSL || SUPPORT_PROFILE_GLSPIRV
@@ -826,6 +1004,20 @@ static GLuint impl_GLSL_LinkProgram(MOJOSHADER_glShader *vshader,
     } // else
 } // impl_GLSL_LinkProgram
 
+#ifdef MOJOSHADER_GLSL_UNIFORM_BUFFERS
+// Returns non-zero if the program has the uniform block (name), after
+//  pointing it at uniform buffer binding point (binding).
+static int glsl_uniform_block(MOJOSHADER_glProgram *program,
+                              const char *name, const GLuint binding)
+{
+    const GLuint idx = ctx->glGetUniformBlockIndex(program->handle, name);
+    if (idx == GL_INVALID_INDEX)
+        return 0;
+    ctx->glUniformBlockBinding(program->handle, idx, binding);
+    return 1;
+} // glsl_uniform_block
+#endif
+
 static void impl_GLSL_FinalInitProgram(MOJOSHADER_glProgram *program)
 {
     program->vs_float4_loc = glsl_uniform_loc(program, "vs_uniforms_vec4");
@@ -838,6 +1030,20 @@ static void impl_GLSL_FinalInitProgram(MOJOSHADER_glProgram *program)
 #ifdef MOJOSHADER_FLIP_RENDERTARGET
     program->vs_flip_loc = glsl_uniform_loc(program, "vpFlip");
 #endif
+#ifdef MOJOSHADER_GLSL_UNIFORM_BUFFERS
+    // The GLSL profile only makes blocks if the driver's compiler has them.
+    if (ctx->have_GL_ARB_uniform_buffer_object)
+    {
+        program->uses_uniform_block[0] =
+            glsl_uniform_block(program, "vs_uniforms_block", 0);
+        program->uses_uniform_block[1] =
+            glsl_uniform_block(program, "ps_uniforms_block", 1);
+        if (program->uses_uniform_block[0])
+            program->vs_float4_loc = -1;
+        if (program->uses_uniform_block[1])
+            program->ps_float4_loc = -1;
+    } // if
+#endif
 } // impl_GLSL_FinalInitProgram
 
 
@@ -860,55 +1066,107 @@ static void impl_GLSL_PushConstantArray(MOJOSHADER_glProgram *program,
 } // impl_GLSL_PushConstantArray
 
 
-static void impl_GLSL_PushUniforms(void)
+// GLSL doesn't promise that array elements have consecutive locations, so
+//  we ask for "name[i]" the first time we need to start an upload at (i).
+static GLint glsl_array_element_loc(MOJOSHADER_glProgram *program,
+                                    const int array, const uint32 idx)
 {
-    const MOJOSHADER_glProgram *program = ctx->bound_program;
-
-    assert(program->uniform_count > 0);  // don't call with nothing to do!
+    static const char *names[UNIFORM_ARRAY_TOTAL] = {
+        "vs_uniforms_vec4", "vs_uniforms_ivec4", "vs_uniforms_bool",
+        "ps_uniforms_vec4", "ps_uniforms_ivec4", "ps_uniforms_bool"
+    };
 
-    if (program->vs_float4_loc != -1)
+    GLint *locs = program->element_loc[array];
+    if (locs == NULL)
     {
-        ctx->glUniform4fv(program->vs_float4_loc,
-                          program->vs_uniforms_float4_count,
-                          program->vs_uniforms_float4);
+        const size_t count = uniform_array_count(program, array);
+        size_t i;
+        locs = (GLint *) Malloc(sizeof (GLint) * count);
+        if (locs == NULL)
+            return -1;
+        for (i = 0; i < count; i++)
+            locs[i] = -2;  // -1 is taken: that means "optimized out."
+        program->element_loc[array] = locs;
     } // if
 
-    if (program->vs_int4_loc != -1)
+    if (locs[idx] == -2)
     {
-        ctx->glUniform4iv(program->vs_int4_loc,
-                          program->vs_uniforms_int4_count,
-                          program->vs_uniforms_int4);
+        char name[64];
+        snprintf(name, sizeof (name), "%s[%u]", names[array], (uint) idx);
+        locs[idx] = glsl_uniform_loc(program, name);
     } // if
 
-    if (program->vs_bool_loc != -1)
-    {
-        ctx->glUniform1iv(program->vs_bool_loc,
-                          program->vs_uniforms_bool_count,
-                          program->vs_uniforms_bool);
-    } // if
+    return locs[idx];
+} // glsl_array_element_loc
 
-    if (program->ps_float4_loc != -1)
-    {
-        ctx->glUniform4fv(program->ps_float4_loc,
-                          program->ps_uniforms_float4_count,
-                          program->ps_uniforms_float4);
-    } // if
 
-    if (program->ps_int4_loc != -1)
-    {
-        ctx->glUniform4iv(program->ps_int4_loc,
-                          program->ps_uniforms_int4_count,
-                          program->ps_uniforms_int4);
-    } // if
+// Push the dirty part of each of the bound program's uniform arrays.
+//  (consecutive) is true if array elements have consecutive locations, like
+//  they do with the explicit locations in our SPIR-V.
+static void glsl_push_uniform_arrays(const int consecutive)
+{
+    MOJOSHADER_glProgram *program = ctx->bound_program;
+    const GLint locs[UNIFORM_ARRAY_TOTAL] = {
+        program->vs_float4_loc, program->vs_int4_loc, program->vs_bool_loc,
+        program->ps_float4_loc, program->ps_int4_loc, program->ps_bool_loc
+    };
+    int i;
 
-    if (program->ps_bool_loc != -1)
+    for (i = 0; i < UNIFORM_ARRAY_TOTAL; i++)
     {
-        ctx->glUniform1iv(program->ps_bool_loc,
-                          program->ps_uniforms_bool_count,
-                          program->ps_uniforms_bool);
-    } // if
+        const uint32 start = program->dirty_start[i];
+        const GLsizei count = (GLsizei) (program->dirty_end[i] - start);
+        GLint loc = locs[i];
+
+        if ((loc == -1) || (count == 0))
+            continue;
+        else if (start == 0)
+            ;  // base location is element 0.
+        else if (consecutive)
+            loc += (GLint) start;
+        else if ((loc = glsl_array_element_loc(program, i, start)) == -1)
+            continue;  // this part of the array was optimized out.
+
+        switch ((RegisterFile) i)
+        {
+            case REGFILE_VS_FLOAT4:
+                ctx->glUniform4fv(loc, count, program->vs_uniforms_float4 + (start * 4));
+                break;
+            case REGFILE_VS_INT4:
+                ctx->glUniform4iv(loc, count, program->vs_uniforms_int4 + (start * 4));
+                break;
+            case REGFILE_VS_BOOL:
+                ctx->glUniform1iv(loc, count, program->vs_uniforms_bool + start);
+                break;
+            case REGFILE_PS_FLOAT4:
+                ctx->glUniform4fv(loc, count, program->ps_uniforms_float4 + (start * 4));
+                break;
+            case REGFILE_PS_INT4:
+                ctx->glUniform4iv(loc, count, program->ps_uniforms_int4 + (start * 4));
+                break;
+            case REGFILE_PS_BOOL:
+                ctx->glUniform1iv(loc, count, program->ps_uniforms_bool + start);
+                break;
+            default:
+                assert(0 && "Unexpected uniform array");
+                break;
+        } // switch
+    } // for
+} // glsl_push_uniform_arrays
+
+
+static void impl_GLSL_PushUniforms(void)
+{
+    glsl_push_uniform_arrays(0);
 } // impl_GLSL_PushUniforms
 
+#if SUPPORT_PROFILE_GLSPIRV
+static void impl_SPIRV_PushUniforms(void)
+{
+    glsl_push_uniform_arrays(1);
+} // impl_SPIRV_PushUniforms
+#endif
+
 
 static void impl_GLSL_PushSampler(GLint loc, GLuint sampler)
 {
@@ -1050,6 +1308,13 @@ static void impl_ARB1_PushConstantArray(MOJOSHADER_glProgram *program,
 } // impl_ARB1_PushConstantArray
 
 
+static inline int arb1_uniform_dirty(const MOJOSHADER_glProgram *program,
+                                     const int array, const uint32 idx)
+{
+    return ( (idx >= program->dirty_start[array]) &&
+             (idx < program->dirty_end[array]) );
+} // arb1_uniform_dirty
+
 static void impl_ARB1_PushUniforms(void)
 {
     // vertex shader uniforms come first in program->uniforms array.
@@ -1060,12 +1325,16 @@ static void impl_ARB1_PushUniforms(void)
     const GLfloat *srcf = program->vs_uniforms_float4;
     const GLint *srci = program->vs_uniforms_int4;
     const GLint *srcb = program->vs_uniforms_bool;
+    int arrayf = REGFILE_VS_FLOAT4;
+    int arrayi = REGFILE_VS_INT4;
+    int arrayb = REGFILE_VS_BOOL;
+    uint32 idxf = 0;
+    uint32 idxi = 0;
+    uint32 idxb = 0;
     GLint loc = 0;
     GLint texbem_loc = 0;
     uint32 i;
 
-    assert(count > 0);  // shouldn't call this with nothing to do!
-
     for (i = 0; i < count; i++)
     {
         UniformMap *map = &program->uniforms[i];
@@ -1090,6 +1359,10 @@ static void impl_ARB1_PushUniforms(void)
                 srcf = program->ps_uniforms_float4;
                 srci = program->ps_uniforms_int4;
                 srcb = program->ps_uniforms_bool;
+                arrayf = REGFILE_PS_FLOAT4;
+                arrayi = REGFILE_PS_INT4;
+                arrayb = REGFILE_PS_BOOL;
+                idxf = idxi = idxb = 0;
                 loc = 0;
             } // if
             else
@@ -1102,11 +1375,15 @@ static void impl_ARB1_PushUniforms(void)
             arb_shader_type = arb1_shader_type(uniform_shader_type);
         } // if
 
+        // only registers that changed since the last push go to the GL.
         if (type == MOJOSHADER_UNIFORM_FLOAT)
         {
             int i;
-            for (i = 0; i < size; i++, srcf += 4, loc++)
-                ctx->glProgramLocalParameter4fvARB(arb_shader_type, loc, srcf);
+            for (i = 0; i < size; i++, srcf += 4, loc++, idxf++)
+            {
+                if (arb1_uniform_dirty(program, arrayf, idxf))
+                    ctx->glProgramLocalParameter4fvARB(arb_shader_type, loc, srcf);
+            } // for
         } // if
         else if (type == MOJOSHADER_UNIFORM_INT)
         {
@@ -1114,13 +1391,18 @@ static void impl_ARB1_PushUniforms(void)
             if (ctx->have_GL_NV_gpu_program4)
             {
                 // GL_NV_gpu_program4 has integer uniform loading support.
-                for (i = 0; i < size; i++, srci += 4, loc++)
-                    ctx->glProgramLocalParameterI4ivNV(arb_shader_type, loc, srci);
+                for (i = 0; i < size; i++, srci += 4, loc++, idxi++)
+                {
+                    if (arb1_uniform_dirty(program, arrayi, idxi))
+                        ctx->glProgramLocalParameterI4ivNV(arb_shader_type, loc, srci);
+                } // for
             } // if
             else
             {
-                for (i = 0; i < size; i++, srci += 4, loc++)
+                for (i = 0; i < size; i++, srci += 4, loc++, idxi++)
                 {
+                    if (!arb1_uniform_dirty(program, arrayi, idxi))
+                        continue;
                     const GLfloat fv[4] = {
                         (GLfloat) srci[0], (GLfloat) srci[1],
                         (GLfloat) srci[2], (GLfloat) srci[3]
@@ -1135,8 +1417,10 @@ static void impl_ARB1_PushUniforms(void)
             if (ctx->have_GL_NV_gpu_program4)
             {
                 // GL_NV_gpu_program4 has integer uniform loading support.
-                for (i = 0; i < size; i++, srcb++, loc++)
+                for (i = 0; i < size; i++, srcb++, loc++, idxb++)
                 {
+                    if (!arb1_uniform_dirty(program, arrayb, idxb))
+                        continue;
                     const GLint ib = (GLint) ((*srcb) ? 1 : 0);
                     const GLint iv[4] = { ib, ib, ib, ib };
                     ctx->glProgramLocalParameterI4ivNV(arb_shader_type, loc, iv);
@@ -1144,8 +1428,10 @@ static void impl_ARB1_PushUniforms(void)
             } // if
             else
             {
-                for (i = 0; i < size; i++, srcb++, loc++)
+                for (i = 0; i < size; i++, srcb++, loc++, idxb++)
                 {
+                    if (!arb1_uniform_dirty(program, arrayb, idxb))
+                        continue;
                     const GLfloat fb = (GLfloat) ((*srcb) ? 1.0f : 0.0f);
                     const GLfloat fv[4] = { fb, fb, fb, fb };
                     ctx->glProgramLocalParameter4fvARB(arb_shader_type, loc, fv);
@@ -1158,13 +1444,17 @@ static void impl_ARB1_PushUniforms(void)
     {
         const GLenum target = GL_FRAGMENT_PROGRAM_ARB;
         GLfloat *srcf = program->ps_uniforms_float4;
-        srcf += (program->ps_uniforms_float4_count * 4) -
-                (program->texbem_count * 8);
+        idxf = program->ps_uniforms_float4_count - (program->texbem_count * 2);
+        srcf += idxf * 4;
         loc = texbem_loc;
-        for (i = 0; i < program->texbem_count; i++, srcf += 8)
+        for (i = 0; i < program->texbem_count; i++, srcf += 8, idxf += 2)
         {
-            ctx->glProgramLocalParameter4fvARB(target, loc++, srcf);
-            ctx->glProgramLocalParameter4fvARB(target, loc++, srcf + 4);
+            if (arb1_uniform_dirty(program, REGFILE_PS_FLOAT4, idxf))
+            {
+                ctx->glProgramLocalParameter4fvARB(target, loc, srcf);
+                ctx->glProgramLocalParameter4fvARB(target, loc + 1, srcf + 4);
+            } // if
+            loc += 2;
         } // for
     } // if
 } // impl_ARB1_PushUniforms
@@ -1279,6 +1569,21 @@ static void lookup_entry_points(MOJOSHADER_glGetProcAddress lookup, void *d)
     DO_LOOKUP(GL_ARB_instanced_arrays, PFNGLVERTEXATTRIBDIVISORARBPROC, glVertexAttribDivisorARB);
     DO_LOOKUP(GL_ARB_ES2_compatibility, PFNGLSHADERBINARYPROC, glShaderBinary);
     DO_LOOKUP(GL_ARB_gl_spirv, PFNGLSPECIALIZESHADERARBPROC, glSpecializeShaderARB);
+#ifdef MOJOSHADER_GLSL_UNIFORM_BUFFERS
+    DO_LOOKUP(GL_ARB_uniform_buffer_object, PFNGLGENBUFFERSPROC, glGenBuffers);
+    DO_LOOKUP(GL_ARB_uniform_buffer_object, PFNGLDELETEBUFFERSPROC, glDeleteBuffers);
+    DO_LOOKUP(GL_ARB_uniform_buffer_object, PFNGLBINDBUFFERPROC, glBindBuffer);
+    DO_LOOKUP(GL_ARB_uniform_buffer_object, PFNGLBUFFERDATAPROC, glBufferData);
+    DO_LOOKUP(GL_ARB_uniform_buffer_object, PFNGLBUFFERSUBDATAPROC, glBufferSubData);
+    DO_LOOKUP(GL_ARB_uniform_buffer_object, PFNGLBINDBUFFERRANGEPROC, glBindBufferRange);
+    DO_LOOKUP(GL_ARB_uniform_buffer_object, PFNGLGETUNIFORMBLOCKINDEXPROC, glGetUniformBlockIndex);
+    DO_LOOKUP(GL_ARB_uniform_buffer_object, PFNGLUNIFORMBLOCKBINDINGPROC, glUniformBlockBinding);
+    DO_LOOKUP(GL_ARB_buffer_storage, PFNGLBUFFERSTORAGEPROC, glBufferStorage);
+    DO_LOOKUP(GL_ARB_buffer_storage, PFNGLMAPBUFFERRANGEPROC, glMapBufferRange);
+    DO_LOOKUP(GL_ARB_sync, PFNGLFENCESYNCPROC, glFenceSync);
+    DO_LOOKUP(GL_ARB_sync, PFNGLCLIENTWAITSYNCPROC, glClientWaitSync);
+    DO_LOOKUP(GL_ARB_sync, PFNGLDELETESYNCPROC, glDeleteSync);
+#endif
 
     #undef DO_LOOKUP
 } // lookup_entry_points
@@ -1399,6 +1704,11 @@ static void load_extensions(MOJOSHADER_glGetProcAddress lookup, void *d)
     ctx->have_GL_ARB_instanced_arrays = 1;
     ctx->have_GL_ARB_ES2_compatibility = 1;
     ctx->have_GL_ARB_gl_spirv = 1;
+#ifdef MOJOSHADER_GLSL_UNIFORM_BUFFERS
+    ctx->have_GL_ARB_uniform_buffer_object = 1;
+    ctx->have_GL_ARB_buffer_storage = 1;
+    ctx->have_GL_ARB_sync = 1;
+#endif
 
     lookup_entry_points(lookup, d);
 
@@ -1504,6 +1814,12 @@ static void load_extensions(MOJOSHADER_glGetProcAddress lookup, void *d)
     VERIFY_EXT(GL_ARB_instanced_arrays, 3, 3);
     VERIFY_EXT(GL_ARB_ES2_compatibility, 4, 1);
     VERIFY_EXT(GL_ARB_gl_spirv, -1, -1);
+#ifdef MOJOSHADER_GLSL_UNIFORM_BUFFERS
+    // Uniform buffers are core in OpenGL ES 3.0, too.
+    VERIFY_EXT(GL_ARB_uniform_buffer_object, 3, ctx->have_opengl_es ? 0 : 1);
+    VERIFY_EXT(GL_ARB_buffer_storage, 4, 4);
+    VERIFY_EXT(GL_ARB_sync, 3, 2);
+#endif
 
     #undef VERIFY_EXT
 
@@ -1772,7 +2088,7 @@ MOJOSHADER_glContext *MOJOSHADER_glCreateContext(const char *profile,
         ctx->profileFinalInitProgram = impl_SPIRV_FinalInitProgram;
         ctx->profileUseProgram = impl_GLSL_UseProgram;
         ctx->profilePushConstantArray = impl_GLSL_PushConstantArray;
-        ctx->profilePushUniforms = impl_GLSL_PushUniforms;
+        ctx->profilePushUniforms = impl_SPIRV_PushUniforms;
         ctx->profilePushSampler = impl_GLSL_PushSampler;
         ctx->profileMustPushConstantArrays = impl_GLSL_MustPushConstantArrays;
         ctx->profileMustPushSamplers = impl_GLSL_MustPushSamplers;
@@ -1884,9 +2200,6 @@ MOJOSHADER_glShader *MOJOSHADER_glCompileShader(const unsigned char *tokenbuf,
                                                 const MOJOSHADER_samplerMap *smap,
                                                 const unsigned int smapcount)
 {
-    MOJOSHADER_glShader *retval = NULL;
-    GLuint shader = 0;
-
     // This doesn't need a mainfn, since there's no GL lang that does.
     const MOJOSHADER_parseData *pd = MOJOSHADER_parse(ctx->profile, NULL,
                                                       tokenbuf, bufsize,
@@ -1895,6 +2208,41 @@ MOJOSHADER_glShader *MOJOSHADER_glCompileShader(const unsigned char *tokenbuf,
                                                       ctx->malloc_fn,
                                                       ctx->free_fn,
                                                       ctx->malloc_data);
+    return MOJOSHADER_glCompileParsedShader(pd);
+} // MOJOSHADER_glCompileShader
+
+
+// Parse data reports the profile it was translated for, and profiles that
+//  extend another one (see profileMap in mojoshader.c) report their base.
+static const char *parse_profile(const char *profile)
+{
+    static const struct { const char *from; const char *to; } map[] =
+    {
+        { MOJOSHADER_PROFILE_GLSPIRV, MOJOSHADER_PROFILE_SPIRV },
+        { MOJOSHADER_PROFILE_GLSLES, MOJOSHADER_PROFILE_GLSL },
+        { MOJOSHADER_PROFILE_GLSLES3, MOJOSHADER_PROFILE_GLSL },
+        { MOJOSHADER_PROFILE_GLSL120, MOJOSHADER_PROFILE_GLSL },
+        { MOJOSHADER_PROFILE_NV2, MOJOSHADER_PROFILE_ARB1 },
+        { MOJOSHADER_PROFILE_NV3, MOJOSHADER_PROFILE_ARB1 },
+        { MOJOSHADER_PROFILE_NV4, MOJOSHADER_PROFILE_ARB1 },
+    };
+    int i;
+
+    for (i = 0; i < STATICARRAYLEN(map); i++)
+    {
+        if (strcmp(map[i].from, profile) == 0)
+            return map[i].to;
+    } // for
+
+    return profile;
+} // parse_profile
+
+
+MOJOSHADER_glShader *MOJOSHADER_glCompileParsedShader(const MOJOSHADER_parseData *pd)
+{
+    MOJOSHADER_glShader *retval = NULL;
+    GLuint shader = 0;
+
     if (pd->error_count > 0)
     {
         // !!! FIXME: put multiple errors in the buffer? Don't use
@@ -1902,6 +2250,11 @@ MOJOSHADER_glShader *MOJOSHADER_glCompileShader(const unsigned char *tokenbuf,
         set_error(pd->errors[0].error);
         goto compile_shader_fail;
     } // if
+    else if (strcmp(pd->profile, parse_profile(ctx->profile)) != 0)
+    {
+        set_error("shader was translated for a different profile");
+        goto compile_shader_fail;
+    } // else if
 
     retval = (MOJOSHADER_glShader *) Malloc(sizeof (MOJOSHADER_glShader));
     if (retval == NULL)
@@ -1921,7 +2274,7 @@ compile_shader_fail:
     if (shader != 0)
         ctx->profileDeleteShader(shader);
     return NULL;
-} // MOJOSHADER_glCompileShader
+} // MOJOSHADER_glCompileParsedShader
 
 
 void MOJOSHADER_glShaderAddRef(MOJOSHADER_glShader *shader)
@@ -1957,6 +2310,7 @@ static void shader_unref(MOJOSHADER_glShader *shader)
 
 static void program_unref(MOJOSHADER_glProgram *program)
 {
+    int i;
     if (program != NULL)
     {
         const uint32 refcount = program->refcount;
@@ -1964,6 +2318,7 @@ static void program_unref(MOJOSHADER_glProgram *program)
             program->refcount--;
         else
         {
+            ctx->live_programs--;
             ctx->profileDeleteProgram(program->handle);
             shader_unref(program->vertex);
             shader_unref(program->fragment);
@@ -1973,6 +2328,11 @@ static void program_unref(MOJOSHADER_glProgram *program)
             Free(program->ps_uniforms_float4);
             Free(program->ps_uniforms_int4);
             Free(program->ps_uniforms_bool);
+            for (i = 0; i < UNIFORM_ARRAY_TOTAL; i++)
+            {
+                Free(program->spans[i]);
+                Free(program->element_loc[i]);
+            } // for
             Free(program->uniforms);
             Free(program->attributes);
             Free(program);
@@ -2212,10 +2572,85 @@ static int build_constants_lists(MOJOSHADER_glProgram *program)
 } // build_constants_lists
 
 
+// Map each register file to where its registers live in the program's
+//  uniform arrays, so ProgramReady() can go straight from a changed register
+//  to the array elements it feeds.
+static int build_register_spans(MOJOSHADER_glProgram *program)
+{
+    uint32 offsets[UNIFORM_ARRAY_TOTAL];
+    uint32 i;
+    int array;
+
+    memset(offsets, '\0', sizeof (offsets));
+
+    for (i = 0; i < program->uniform_count; i++)
+    {
+        const UniformMap *map = &program->uniforms[i];
+        const int base = (map->shader_type == MOJOSHADER_TYPE_PIXEL) ? REGFILE_PS_FLOAT4 : REGFILE_VS_FLOAT4;
+        array = base + ((int) map->uniform->type);
+        assert(array < UNIFORM_ARRAY_TOTAL);
+        program->span_count[array]++;
+    } // for
+
+    for (array = 0; array < UNIFORM_ARRAY_TOTAL; array++)
+    {
+        if (program->span_count[array] == 0)
+            continue;
+        const size_t len = sizeof (RegisterSpan) * program->span_count[array];
+        program->spans[array] = (RegisterSpan *) Malloc(len);
+        if (program->spans[array] == NULL)
+            return 0;
+        program->span_count[array] = 0;
+    } // for
+
+    // the uniform arrays are packed in the same order as program->uniforms.
+    for (i = 0; i < program->uniform_count; i++)
+    {
+        const UniformMap *map = &program->uniforms[i];
+        const MOJOSHADER_uniform *u = map->uniform;
+        const int base = (map->shader_type == MOJOSHADER_TYPE_PIXEL) ? REGFILE_PS_FLOAT4 : REGFILE_VS_FLOAT4;
+        RegisterSpan *spans;
+        uint32 pos;
+
+        array = base + ((int) u->type);
+        spans = program->spans[array];
+        pos = program->span_count[array]++;
+
+        // keep them sorted by register. They almost always arrive in order.
+        while ((pos > 0) && (spans[pos - 1].first > (uint32) u->index))
+        {
+            spans[pos] = spans[pos - 1];
+            pos--;
+        } // while
+
+        spans[pos].first = (uint32) u->index;
+        spans[pos].count = (uint32) (u->array_count ? u->array_count : 1);
+        spans[pos].offset = offsets[array];
+        offsets[array] += spans[pos].count;
+    } // for
+
+    for (array = 0; array < UNIFORM_ARRAY_TOTAL; array++)
+    {
+        RegisterSpan *spans = program->spans[array];
+        uint32 reach = 0;
+        for (i = 0; i < program->span_count[array]; i++)
+        {
+            const uint32 end = spans[i].first + spans[i].count;
+            if (end > reach)
+                reach = end;
+            spans[i].reach = reach;
+        } // for
+    } // for
+
+    return 1;
+} // build_register_spans
+
+
 MOJOSHADER_glProgram *MOJOSHADER_glLinkProgram(MOJOSHADER_glShader *vshader,
                                                MOJOSHADER_glShader *pshader)
 {
     int bound = 0;
+    int i;
 
     if ((vshader == NULL) && (pshader == NULL))
         return NULL;
@@ -2284,11 +2719,15 @@ MOJOSHADER_glProgram *MOJOSHADER_glLinkProgram(MOJOSHADER_glShader *vshader,
     if (!build_constants_lists(retval))
         goto link_program_fail;
 
+    if (!build_register_spans(retval))
+        goto link_program_fail;
+
     if (bound)  // reset the old binding.
         ctx->profileUseProgram(ctx->bound_program);
 
     ctx->profileFinalInitProgram(retval);
 
+    ctx->live_programs++;
     return retval;
 
 link_program_fail:
@@ -2300,6 +2739,8 @@ link_program_fail:
         Free(retval->ps_uniforms_float4);
         Free(retval->ps_uniforms_int4);
         Free(retval->ps_uniforms_bool);
+        for (i = 0; i < UNIFORM_ARRAY_TOTAL; i++)
+            Free(retval->spans[i]);
         Free(retval->uniforms);
         Free(retval->attributes);
         Free(retval);
@@ -2372,6 +2813,39 @@ typedef struct
     MOJOSHADER_glShader *fragment;
 } BoundShaders;
 
+// The linker cache's keys are BoundShaders, and its values are these.
+struct LinkerCacheItem
+{
+    BoundShaders shaders;  // first, so an item is also its own key.
+    MOJOSHADER_glProgram *program;
+    LinkerCacheItem *prev;  // bound more recently.
+    LinkerCacheItem *next;  // bound less recently.
+};
+
+static void lru_unlink(LinkerCacheItem *item)
+{
+    if (item->prev != NULL)
+        item->prev->next = item->next;
+    else
+        ctx->linker_lru_head = item->next;
+    if (item->next != NULL)
+        item->next->prev = item->prev;
+    else
+        ctx->linker_lru_tail = item->prev;
+    item->prev = item->next = NULL;
+} // lru_unlink
+
+static void lru_push(LinkerCacheItem *item)
+{
+    item->prev = NULL;
+    item->next = ctx->linker_lru_head;
+    if (ctx->linker_lru_head != NULL)
+        ctx->linker_lru_head->prev = item;
+    else
+        ctx->linker_lru_tail = item;
+    ctx->linker_lru_head = item;
+} // lru_push
+
 static uint32 hash_shaders(const void *sym, void *data)
 {
     (void) data;
@@ -2404,10 +2878,23 @@ static void nuke_shaders(const void *_ctx, const void *key, const void *value, v
 {
     (void) _ctx;
     (void) data;
-    Free((void *) key);  // this was a BoundShaders struct.
-    MOJOSHADER_glDeleteProgram((MOJOSHADER_glProgram *) value);
+    LinkerCacheItem *item = (LinkerCacheItem *) value;  // (key) is in here.
+    lru_unlink(item);
+    ctx->linker_cache_count--;
+    MOJOSHADER_glDeleteProgram(item->program);
+    Free(item);
 } // nuke_shaders
 
+// Drop the least recently bound programs until only (count) are cached.
+static void trim_linker_cache(const uint32 count)
+{
+    while ((ctx->linker_cache_count > count) && (ctx->linker_lru_tail != NULL))
+    {
+        hash_remove(ctx->linker_cache, ctx->linker_lru_tail, ctx);
+        ctx->linker_stats.evictions++;
+    } // while
+} // trim_linker_cache
+
 void MOJOSHADER_glBindShaders(MOJOSHADER_glShader *v, MOJOSHADER_glShader *p)
 {
     if ((v == NULL) && (p == NULL))
@@ -2431,34 +2918,53 @@ void MOJOSHADER_glBindShaders(MOJOSHADER_glShader *v, MOJOSHADER_glShader *p)
     } // if
 
     MOJOSHADER_glProgram *program = NULL;
+    LinkerCacheItem *item = NULL;
     BoundShaders shaders;
     shaders.vertex = v;
     shaders.fragment = p;
 
     const void *val = NULL;
     if (hash_find(ctx->linker_cache, &shaders, &val))
-        program = (MOJOSHADER_glProgram *) val;
+    {
+        item = (LinkerCacheItem *) val;
+        program = item->program;
+        ctx->linker_stats.hits++;
+        if (item != ctx->linker_lru_head)
+        {
+            lru_unlink(item);
+            lru_push(item);
+        } // if
+    } // if
     else
     {
+        ctx->linker_stats.misses++;
         program = MOJOSHADER_glLinkProgram(v, p);
         if (program == NULL)
             return;
+        ctx->linker_stats.links++;
 
-        BoundShaders *item = (BoundShaders *) Malloc(sizeof (BoundShaders));
+        item = (LinkerCacheItem *) Malloc(sizeof (LinkerCacheItem));
         if (item == NULL)
         {
             MOJOSHADER_glDeleteProgram(program);
             return;
         } // if
 
-        memcpy(item, &shaders, sizeof (BoundShaders));
-        if (hash_insert(ctx->linker_cache, item, program) != 1)
+        memcpy(&item->shaders, &shaders, sizeof (BoundShaders));
+        item->program = program;
+        if (hash_insert(ctx->linker_cache, item, item) != 1)
         {
             Free(item);
             MOJOSHADER_glDeleteProgram(program);
             out_of_memory();
             return;
         } // if
+        lru_push(item);
+        ctx->linker_cache_count++;
+
+        // The new one is the most recent, so this never drops it.
+        if (ctx->linker_cache_capacity > 0)
+            trim_linker_cache(ctx->linker_cache_capacity);
     } // else
 
     assert(program != NULL);
@@ -2486,12 +2992,72 @@ void MOJOSHADER_glGetBoundShaders(MOJOSHADER_glShader **v,
 } // MOJOSHADER_glGetBoundShaders
 
 
+void MOJOSHADER_glSetLinkerCacheCapacity(unsigned int capacity)
+{
+    ctx->linker_cache_capacity = capacity;
+    if ((capacity > 0) && (ctx->linker_cache != NULL))
+        trim_linker_cache(capacity);
+} // MOJOSHADER_glSetLinkerCacheCapacity
+
+
+void MOJOSHADER_glTrimLinkerCache(unsigned int count)
+{
+    if (ctx->linker_cache != NULL)
+        trim_linker_cache(count);
+} // MOJOSHADER_glTrimLinkerCache
+
+
+void MOJOSHADER_glGetLinkerCacheStats(MOJOSHADER_glLinkerCacheStats *stats)
+{
+    memcpy(stats, &ctx->linker_stats, sizeof (MOJOSHADER_glLinkerCacheStats));
+    stats->cached_programs = ctx->linker_cache_count;
+    stats->live_programs = ctx->live_programs;
+} // MOJOSHADER_glGetLinkerCacheStats
+
+
 static inline uint minuint(const uint a, const uint b)
 {
     return ((a < b) ? a : b);
 } // minuint
 
 
+// Bump the generation and note which registers changed, for ProgramReady().
+static void registers_changed(const RegisterFile file, const uint32 start,
+                              const uint32 end)
+{
+    const uint32 generation = ++ctx->generation;
+
+    // Setting a block of registers a few at a time is common, so grow the
+    //  newest range if this touches it, instead of logging a new one.
+    if (ctx->dirty_log_used > 0)
+    {
+        const uint32 newest = (ctx->dirty_log_next + DIRTY_LOG_SIZE - 1) % DIRTY_LOG_SIZE;
+        DirtyRange *range = &ctx->dirty_log[newest];
+        if ((range->file == file) && (start <= range->end) && (end >= range->start))
+        {
+            range->generation = generation;
+            if (start < range->start)
+                range->start = start;
+            if (end > range->end)
+                range->end = end;
+            return;
+        } // if
+    } // if
+
+    DirtyRange *range = &ctx->dirty_log[ctx->dirty_log_next];
+    if (ctx->dirty_log_used < DIRTY_LOG_SIZE)
+        ctx->dirty_log_used++;
+    else
+        ctx->dirty_floor = range->generation;  // forgetting this one.
+
+    range->generation = generation;
+    range->file = file;
+    range->start = start;
+    range->end = end;
+    ctx->dirty_log_next = (ctx->dirty_log_next + 1) % DIRTY_LOG_SIZE;
+} // registers_changed
+
+
 void MOJOSHADER_glSetVertexShaderUniformF(unsigned int idx, const float *data,
                                           unsigned int vec4n)
 {
@@ -2499,9 +3065,9 @@ void MOJOSHADER_glSetVertexShaderUniformF(unsigned int idx, const float *data,
     if (idx < maxregs)
     {
         assert(sizeof (GLfloat) == sizeof (float));
-        const uint cpy = (minuint(maxregs - idx, vec4n) * sizeof (*data)) * 4;
-        memcpy(ctx->vs_reg_file_f + (idx * 4), data, cpy);
-        ctx->generation++;
+        const uint regs = minuint(maxregs - idx, vec4n);
+        memcpy(ctx->vs_reg_file_f + (idx * 4), data, regs * sizeof (*data) * 4);
+        registers_changed(REGFILE_VS_FLOAT4, idx, idx + regs);
     } // if
 } // MOJOSHADER_glSetVertexShaderUniformF
 
@@ -2526,9 +3092,9 @@ void MOJOSHADER_glSetVertexShaderUniformI(unsigned int idx, const int *data,
     if (idx < maxregs)
     {
         assert(sizeof (GLint) == sizeof (int));
-        const uint cpy = (minuint(maxregs - idx, ivec4n) * sizeof (*data)) * 4;
-        memcpy(ctx->vs_reg_file_i + (idx * 4), data, cpy);
-        ctx->generation++;
+        const uint regs = minuint(maxregs - idx, ivec4n);
+        memcpy(ctx->vs_reg_file_i + (idx * 4), data, regs * sizeof (*data) * 4);
+        registers_changed(REGFILE_VS_INT4, idx, idx + regs);
     } // if
 } // MOJOSHADER_glSetVertexShaderUniformI
 
@@ -2552,11 +3118,12 @@ void MOJOSHADER_glSetVertexShaderUniformB(unsigned int idx, const int *data,
     const uint maxregs = STATICARRAYLEN(ctx->vs_reg_file_b) / 4;
     if (idx < maxregs)
     {
+        const uint regs = minuint(maxregs - idx, bcount);
         uint8 *wptr = ctx->vs_reg_file_b + idx;
-        uint8 *endptr = wptr + minuint(maxregs - idx, bcount);
+        uint8 *endptr = wptr + regs;
         while (wptr != endptr)
             *(wptr++) = *(data++) ? 1 : 0;
-        ctx->generation++;
+        registers_changed(REGFILE_VS_BOOL, idx, idx + regs);
     } // if
 } // MOJOSHADER_glSetVertexShaderUniformB
 
@@ -2582,9 +3149,9 @@ void MOJOSHADER_glSetPixelShaderUniformF(unsigned int idx, const float *data,
     if (idx < maxregs)
     {
         assert(sizeof (GLfloat) == sizeof (float));
-        const uint cpy = (minuint(maxregs - idx, vec4n) * sizeof (*data)) * 4;
-        memcpy(ctx->ps_reg_file_f + (idx * 4), data, cpy);
-        ctx->generation++;
+        const uint regs = minuint(maxregs - idx, vec4n);
+        memcpy(ctx->ps_reg_file_f + (idx * 4), data, regs * sizeof (*data) * 4);
+        registers_changed(REGFILE_PS_FLOAT4, idx, idx + regs);
     } // if
 } // MOJOSHADER_glSetPixelShaderUniformF
 
@@ -2609,9 +3176,9 @@ void MOJOSHADER_glSetPixelShaderUniformI(unsigned int idx, const int *data,
     if (idx < maxregs)
     {
         assert(sizeof (GLint) == sizeof (int));
-        const uint cpy = (minuint(maxregs - idx, ivec4n) * sizeof (*data)) * 4;
-        memcpy(ctx->ps_reg_file_i + (idx * 4), data, cpy);
-        ctx->generation++;
+        const uint regs = minuint(maxregs - idx, ivec4n);
+        memcpy(ctx->ps_reg_file_i + (idx * 4), data, regs * sizeof (*data) * 4);
+        registers_changed(REGFILE_PS_INT4, idx, idx + regs);
     } // if
 } // MOJOSHADER_glSetPixelShaderUniformI
 
@@ -2635,11 +3202,12 @@ void MOJOSHADER_glSetPixelShaderUniformB(unsigned int idx, const int *data,
     const uint maxregs = STATICARRAYLEN(ctx->ps_reg_file_b) / 4;
     if (idx < maxregs)
     {
+        const uint regs = minuint(maxregs - idx, bcount);
         uint8 *wptr = ctx->ps_reg_file_b + idx;
-        uint8 *endptr = wptr + minuint(maxregs - idx, bcount);
+        uint8 *endptr = wptr + regs;
         while (wptr != endptr)
             *(wptr++) = *(data++) ? 1 : 0;
-        ctx->generation++;
+        registers_changed(REGFILE_PS_BOOL, idx, idx + regs);
     } // if
 } // MOJOSHADER_glSetPixelShaderUniformB
 
@@ -2672,7 +3240,11 @@ void MOJOSHADER_glMapUniformBufferMemory(float **vsf, int **vsi, unsigned char *
 
 void MOJOSHADER_glUnmapUniformBufferMemory()
 {
+    // we don't know what the app touched, so every program syncs in full.
+    //  This is the path effects always take, so they don't get to skip
+    //  the compare; they still only upload registers that changed.
     ctx->generation++;
+    ctx->dirty_floor = ctx->generation;
 } // MOJOSHADER_glUnmapUniformBufferMemory
 
 
@@ -2777,10 +3349,346 @@ void MOJOSHADER_glSetLegacyBumpMapEnv(unsigned int sampler, float mat00,
     *(dstf++) = (GLfloat) mat11;
     *(dstf++) = (GLfloat) lscale;
     *(dstf++) = (GLfloat) loffset;
-    ctx->generation++;
+    registers_changed(REGFILE_TEXBEM, sampler - 1, sampler);
 } // MOJOSHADER_glSetLegacyBumpMapEnv
 
 
+// Copy (count) registers, starting at (reg), from a register file to the
+//  program's uniform array at element (idx), noting which ones changed.
+static void sync_registers(MOJOSHADER_glProgram *program,
+                           const RegisterFile file, const uint32 reg,
+                           const uint32 idx, const uint32 count)
+{
+    const int vertex = (file < REGFILE_PS_FLOAT4);
+    uint32 i;
+
+    switch (file)
+    {
+        case REGFILE_VS_FLOAT4:
+        case REGFILE_PS_FLOAT4:
+        {
+            const GLfloat *src = vertex ? ctx->vs_reg_file_f : ctx->ps_reg_file_f;
+            GLfloat *dst = vertex ? program->vs_uniforms_float4 : program->ps_uniforms_float4;
+            src += reg * 4;
+            dst += idx * 4;
+            for (i = 0; i < count; i++, src += 4, dst += 4)
+            {
+                if (memcmp(dst, src, sizeof (GLfloat) * 4) != 0)
+                {
+                    memcpy(dst, src, sizeof (GLfloat) * 4);
+                    mark_uniforms_dirty(program, file, idx + i, idx + i + 1);
+                } // if
+            } // for
+            break;
+        } // case
+
+        case REGFILE_VS_INT4:
+        case REGFILE_PS_INT4:
+        {
+            const GLint *src = vertex ? ctx->vs_reg_file_i : ctx->ps_reg_file_i;
+            GLint *dst = vertex ? program->vs_uniforms_int4 : program->ps_uniforms_int4;
+            src += reg * 4;
+            dst += idx * 4;
+            for (i = 0; i < count; i++, src += 4, dst += 4)
+            {
+                if (memcmp(dst, src, sizeof (GLint) * 4) != 0)
+                {
+                    memcpy(dst, src, sizeof (GLint) * 4);
+                    mark_uniforms_dirty(program, file, idx + i, idx + i + 1);
+                } // if
+            } // for
+            break;
+        } // case
+
+        case REGFILE_VS_BOOL:
+        case REGFILE_PS_BOOL:
+        {
+            const uint8 *src = vertex ? ctx->vs_reg_file_b : ctx->ps_reg_file_b;
+            GLint *dst = vertex ? program->vs_uniforms_bool : program->ps_uniforms_bool;
+            src += reg;
+            dst += idx;
+            for (i = 0; i < count; i++)
+            {
+                if (dst[i] != (GLint) src[i])
+                {
+                    dst[i] = (GLint) src[i];
+                    mark_uniforms_dirty(program, file, idx + i, idx + i + 1);
+                } // if
+            } // for
+            break;
+        } // case
+
+        default:
+            assert(0 && "Unexpected register file");
+            break;
+    } // switch
+} // sync_registers
+
+
+// texbem state lives at the end of the program's pixel shader float array.
+static void sync_texbem(MOJOSHADER_glProgram *program)
+{
+    assert((!program->texbem_count) || (program->fragment));
+    if ((!program->texbem_count) || (!program->fragment))
+        return;
+
+    const MOJOSHADER_parseData *pd = program->fragment->parseData;
+    const int samp_count = pd->sampler_count;
+    const MOJOSHADER_sampler *samps = pd->samplers;
+    uint32 idx = program->ps_uniforms_float4_count - (program->texbem_count * 2);
+    GLfloat *dstf = program->ps_uniforms_float4 + (idx * 4);
+    uint32 texbem_count = 0;
+    int i;
+
+    assert(program->texbem_count <= MAX_TEXBEMS);
+    for (i = 0; i < samp_count; i++)
+    {
+        if (samps[i].texbem)
+        {
+            assert(samps[i].index > 0);
+            assert(samps[i].index <= MAX_TEXBEMS);
+            const GLfloat *srcf = &ctx->texbem_state[6 * (samps[i].index-1)];
+            if ( (memcmp(dstf, srcf, sizeof (GLfloat) * 6) != 0) ||
+                 (dstf[6] != 0.0f) || (dstf[7] != 0.0f) )
+            {
+                memcpy(dstf, srcf, sizeof (GLfloat) * 6);
+                dstf[6] = 0.0f;
+                dstf[7] = 0.0f;
+                mark_uniforms_dirty(program, REGFILE_PS_FLOAT4, idx, idx + 2);
+            } // if
+            dstf += 8;
+            idx += 2;
+            texbem_count++;
+        } // if
+    } // for
+
+    assert(texbem_count == program->texbem_count);
+} // sync_texbem
+
+
+// Update the program's copy of registers [start, end) of a register file.
+static void sync_register_range(MOJOSHADER_glProgram *program,
+                                const RegisterFile file, const uint32 start,
+                                const uint32 end)
+{
+    if (file == REGFILE_TEXBEM)
+    {
+        sync_texbem(program);
+        return;
+    } // if
+
+    const RegisterSpan *spans = program->spans[file];
+    const uint32 total = program->span_count[file];
+    uint32 lo = 0;
+    uint32 hi = total;
+    uint32 i;
+
+    // find the first span that reaches past (start)...
+    while (lo < hi)
+    {
+        const uint32 mid = lo + ((hi - lo) / 2);
+        if (spans[mid].reach <= start)
+            lo = mid + 1;
+        else
+            hi = mid;
+    } // while
+
+    // ...then everything from there that starts before (end).
+    for (i = lo; (i < total) && (spans[i].first < end); i++)
+    {
+        const RegisterSpan *span = &spans[i];
+        const uint32 span_end = span->first + span->count;
+        const uint32 first = (span->first > start) ? span->first : start;
+        const uint32 last = (span_end < end) ? span_end : end;
+        if (first < last)
+        {
+            sync_registers(program, file, first,
+                           span->offset + (first - span->first), last - first);
+        } // if
+    } // for
+} // sync_register_range
+
+
+#ifdef MOJOSHADER_GLSL_UNIFORM_BUFFERS
+static void uniform_ring_init(void)
+{
+    const GLsizeiptr len = UNIFORM_RING_SEGMENTS * UNIFORM_RING_SEGMENT_SIZE;
+    GLint align = 0;
+
+    ctx->glGetIntegerv(GL_UNIFORM_BUFFER_OFFSET_ALIGNMENT, &align);
+    ctx->uniform_ring_align = (align > 0) ? align : 256;
+
+    // Map the whole ring once and leave it mapped, if the GL lets us.
+    ctx->glGenBuffers(1, &ctx->uniform_ring);
+    ctx->glBindBuffer(GL_UNIFORM_BUFFER, ctx->uniform_ring);
+    if (ctx->have_GL_ARB_buffer_storage && ctx->have_GL_ARB_sync)
+    {
+        const GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT |
+                                 GL_MAP_COHERENT_BIT;
+        ctx->glBufferStorage(GL_UNIFORM_BUFFER, len, NULL, flags);
+        ctx->uniform_ring_map = (uint8 *) ctx->glMapBufferRange(
+                                    GL_UNIFORM_BUFFER, 0, len, flags);
+        if (ctx->uniform_ring_map == NULL)
+        {
+            // buffer storage is immutable, so start over with a new one.
+            ctx->glDeleteBuffers(1, &ctx->uniform_ring);
+            ctx->glGenBuffers(1, &ctx->uniform_ring);
+            ctx->glBindBuffer(GL_UNIFORM_BUFFER, ctx->uniform_ring);
+        } // if
+    } // if
+
+    // Otherwise, we'll glBufferSubData() into parts of the ring that the GPU
+    //  isn't reading from, so the driver shouldn't have to stall or copy.
+    if (ctx->uniform_ring_map == NULL)
+        ctx->glBufferData(GL_UNIFORM_BUFFER, len, NULL, GL_DYNAMIC_DRAW);
+} // uniform_ring_init
+
+
+static void uniform_ring_destroy(void)
+{
+    int i;
+    for (i = 0; i < UNIFORM_RING_SEGMENTS; i++)
+    {
+        if (ctx->uniform_ring_fence[i] != NULL)
+            ctx->glDeleteSync(ctx->uniform_ring_fence[i]);
+    } // for
+
+    if (ctx->uniform_ring != 0)
+        ctx->glDeleteBuffers(1, &ctx->uniform_ring);  // unmaps it, too.
+} // uniform_ring_destroy
+
+
+// A slice is current until the ring's head gets to the segment before it;
+//  that's when we fence off its segment to write there again.
+static inline int uniform_slice_current(const UniformSlice *slice)
+{
+    return ( (slice->size > 0) &&
+             ((ctx->uniform_ring_serial - slice->serial) <
+                (UNIFORM_RING_SEGMENTS - 1)) );
+} // uniform_slice_current
+
+
+static void uniform_ring_advance(void)
+{
+    const uint32 serial = ctx->uniform_ring_serial + 1;
+    const uint32 segment = serial % UNIFORM_RING_SEGMENTS;
+    const uint32 ahead = (serial + 1) % UNIFORM_RING_SEGMENTS;
+
+    // glBufferSubData() does its own synchronization, but we're writing
+    //  to persistently-mapped memory behind the GL's back.
+    if (ctx->uniform_ring_map != NULL)
+    {
+        // No slice in the segment after this one is current anymore, so
+        //  draws from here on won't read it. Fence the ones that did.
+        if (ctx->uniform_ring_fence[ahead] != NULL)
+            ctx->glDeleteSync(ctx->uniform_ring_fence[ahead]);
+        ctx->uniform_ring_fence[ahead] =
+            ctx->glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+        // ...and wait on the fence we set when this segment went stale.
+        if (ctx->uniform_ring_fence[segment] != NULL)
+        {
+            GLsync fence = ctx->uniform_ring_fence[segment];
+            while (ctx->glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT,
+                                         1000000000) == GL_TIMEOUT_EXPIRED)
+                ;  // keep waiting.
+            ctx->glDeleteSync(fence);
+            ctx->uniform_ring_fence[segment] = NULL;
+        } // if
+    } // if
+
+    ctx->uniform_ring_serial = serial;
+    ctx->uniform_ring_head = segment * UNIFORM_RING_SEGMENT_SIZE;
+} // uniform_ring_advance
+
+
+static inline GLintptr uniform_ring_aligned_head(void)
+{
+    const GLintptr align = ctx->uniform_ring_align;
+    return ((ctx->uniform_ring_head + align - 1) / align) * align;
+} // uniform_ring_aligned_head
+
+
+static void uniform_ring_write(UniformSlice *slice, const GLfloat *data,
+                               const size_t count)
+{
+    const GLsizeiptr len = (GLsizeiptr) (count * sizeof (GLfloat) * 4);
+    const uint32 segment = ctx->uniform_ring_serial % UNIFORM_RING_SEGMENTS;
+    const GLintptr segment_end = (segment + 1) * UNIFORM_RING_SEGMENT_SIZE;
+    GLintptr offset = uniform_ring_aligned_head();
+
+    assert(len <= UNIFORM_RING_SEGMENT_SIZE);
+    if ((offset + len) > segment_end)
+    {
+        uniform_ring_advance();
+        offset = uniform_ring_aligned_head();
+    } // if
+
+    if (ctx->uniform_ring_map != NULL)
+        memcpy(ctx->uniform_ring_map + offset, data, len);
+    else
+    {
+        ctx->glBindBuffer(GL_UNIFORM_BUFFER, ctx->uniform_ring);
+        ctx->glBufferSubData(GL_UNIFORM_BUFFER, offset, len, data);
+    } // else
+
+    slice->serial = ctx->uniform_ring_serial;
+    slice->offset = offset;
+    slice->size = len;
+    ctx->uniform_ring_head = offset + len;
+} // uniform_ring_write
+
+
+// Make sure the program's float4 blocks are in the ring, and bind them.
+//  A program whose registers didn't change since its last draw just gets
+//  its old part of the ring bound again.
+static void bind_uniform_blocks(MOJOSHADER_glProgram *program)
+{
+    const GLfloat *arrays[2] = {
+        program->vs_uniforms_float4, program->ps_uniforms_float4
+    };
+    const size_t counts[2] = {
+        program->vs_uniforms_float4_count, program->ps_uniforms_float4_count
+    };
+    int stale = 1;
+    int i;
+
+    if (ctx->uniform_ring == 0)
+        uniform_ring_init();
+
+    // Writing one stage can advance the ring past the other stage's slice,
+    //  so keep at it until both are current.
+    while (stale)
+    {
+        stale = 0;
+        for (i = 0; i < 2; i++)
+        {
+            UniformSlice *slice = &program->uniform_slice[i];
+            if (program->uses_uniform_block[i] && !uniform_slice_current(slice))
+            {
+                uniform_ring_write(slice, arrays[i], counts[i]);
+                stale = 1;
+            } // if
+        } // for
+    } // while
+
+    for (i = 0; i < 2; i++)
+    {
+        const UniformSlice *slice = &program->uniform_slice[i];
+        UniformSlice *bound = &ctx->uniform_ring_bound[i];
+        if (!program->uses_uniform_block[i])
+            continue;
+        else if ((bound->offset == slice->offset) && (bound->size == slice->size))
+            continue;  // already bound.
+
+        ctx->glBindBufferRange(GL_UNIFORM_BUFFER, (GLuint) i,
+                               ctx->uniform_ring, slice->offset, slice->size);
+        *bound = *slice;
+    } // for
+} // bind_uniform_blocks
+#endif
+
+
 void MOJOSHADER_glProgramReady(void)
 {
     MOJOSHADER_glProgram *program = ctx->bound_program;
@@ -2801,128 +3709,58 @@ void MOJOSHADER_glProgramReady(void)
     if ( ((program->uniform_count) || (program->texbem_count)) &&
          (program->generation != ctx->generation))
     {
-        // vertex shader uniforms come first in program->uniforms array.
-        const uint32 count = program->uniform_count;
-        const GLfloat *srcf = ctx->vs_reg_file_f;
-        const GLint *srci = ctx->vs_reg_file_i;
-        const uint8 *srcb = ctx->vs_reg_file_b;
-        MOJOSHADER_shaderType shader_type = MOJOSHADER_TYPE_VERTEX;
-        GLfloat *dstf = program->vs_uniforms_float4;
-        GLint *dsti = program->vs_uniforms_int4;
-        GLint *dstb = program->vs_uniforms_bool;
-        uint8 uniforms_changed = 0;
-        uint32 i;
+        const uint32 age = ctx->generation - program->generation;
+        int i;
 
-        for (i = 0; i < count; i++)
+        if ((!program->synced) || (age > (ctx->generation - ctx->dirty_floor)))
         {
-            UniformMap *map = &program->uniforms[i];
-            const MOJOSHADER_shaderType uniform_shader_type = map->shader_type;
-            const MOJOSHADER_uniform *u = map->uniform;
-            const MOJOSHADER_uniformType type = u->type;
-            const int index = u->index;
-            const int size = u->array_count ? u->array_count : 1;
-
-            assert(!u->constant);
-
-            // Did we switch from vertex to pixel (to geometry, etc)?
-            if (shader_type != uniform_shader_type)
-            {
-                // we start with vertex, move to pixel, then to geometry, etc.
-                //  The array should always be sorted as such.
-                if (uniform_shader_type == MOJOSHADER_TYPE_PIXEL)
-                {
-                    assert(shader_type == MOJOSHADER_TYPE_VERTEX);
-                    srcf = ctx->ps_reg_file_f;
-                    srci = ctx->ps_reg_file_i;
-                    srcb = ctx->ps_reg_file_b;
-                    dstf = program->ps_uniforms_float4;
-                    dsti = program->ps_uniforms_int4;
-                    dstb = program->ps_uniforms_bool;
-                } // if
-                else
-                {
-                    // Should be ordered vertex, then pixel, then geometry.
-                    assert(0 && "Unexpected shader type");
-                } // else
-
-                shader_type = uniform_shader_type;
-            } // if
-
-            if (type == MOJOSHADER_UNIFORM_FLOAT)
-            {
-                const size_t count = 4 * size;
-                const GLfloat *f = &srcf[index * 4];
-                if (memcmp(dstf, f, sizeof (GLfloat) * count) != 0)
-                {
-                    memcpy(dstf, f, sizeof (GLfloat) * count);
-                    uniforms_changed = 1;
-                }
-                dstf += count;
-            } // if
-            else if (type == MOJOSHADER_UNIFORM_INT)
-            {
-                const size_t count = 4 * size;
-                const GLint *i = &srci[index * 4];
-                if (memcmp(dsti, i, sizeof (GLint) * count) != 0)
-                {
-                    memcpy(dsti, i, sizeof (GLint) * count);
-                    uniforms_changed = 1;
-                } // if
-                dsti += count;
-            } // else if
-            else if (type == MOJOSHADER_UNIFORM_BOOL)
-            {
-                const size_t count = size;
-                const uint8 *b = &srcb[index];
-                size_t i;
-                for (i = 0; i < count; i++)
-                    if (dstb[i] != b[i])
-                    {
-                        dstb[i] = (GLint) b[i];
-                        uniforms_changed = 1;
-                    } // if
-                dstb += count;
-            } // else if
-
-            // !!! FIXME: set constants that overlap the array.
-        } // for
-
-        assert((!program->texbem_count) || (program->fragment));
-        if ((program->texbem_count) && (program->fragment))
+            // the dirty log doesn't go back far enough, check everything.
+            for (i = 0; i < UNIFORM_ARRAY_TOTAL; i++)
+                sync_register_range(program, (RegisterFile) i, 0, 0xFFFFFFFF);
+            sync_texbem(program);
+            program->synced = 1;
+        } // if
+        else
         {
-            const MOJOSHADER_parseData *pd = program->fragment->parseData;
-            const int samp_count = pd->sampler_count;
-            const MOJOSHADER_sampler *samps = pd->samplers;
-            GLfloat *dstf = program->ps_uniforms_float4;
-            int texbem_count = 0;
-
-            dstf += (program->ps_uniforms_float4_count * 4) -
-                     (program->texbem_count * 8);
-
-            assert(program->texbem_count <= MAX_TEXBEMS);
-            for (i = 0; i < samp_count; i++)
+            // walk back through the log until we reach changes we've seen.
+            uint32 n;
+            for (n = 0; n < ctx->dirty_log_used; n++)
             {
-                if (samps[i].texbem)
-                {
-                    assert(samps[i].index > 0);
-                    assert(samps[i].index <= MAX_TEXBEMS);
-                    memcpy(dstf, &ctx->texbem_state[6 * (samps[i].index-1)],
-                           sizeof (GLfloat) * 6);
-                    dstf[6] = 0.0f;
-                    dstf[7] = 0.0f;
-                    dstf += 8;
-                    texbem_count++;
-                } // if
+                const uint32 pos = (ctx->dirty_log_next + DIRTY_LOG_SIZE - 1 - n) % DIRTY_LOG_SIZE;
+                const DirtyRange *range = &ctx->dirty_log[pos];
+                if ((ctx->generation - range->generation) >= age)
+                    break;
+                sync_register_range(program, range->file, range->start, range->end);
             } // for
-
-            assert(texbem_count == program->texbem_count);
-        } // if
+        } // else
 
         program->generation = ctx->generation;
 
-        if (uniforms_changed)
+        for (i = 0; i < UNIFORM_ARRAY_TOTAL; i++)
+        {
+            if (program->dirty_start[i] != program->dirty_end[i])
+                break;
+        } // for
+
+        if (i < UNIFORM_ARRAY_TOTAL)
+        {
+#ifdef MOJOSHADER_GLSL_UNIFORM_BUFFERS
+            // changed float4 blocks go to a fresh part of the ring, below.
+            if (program->dirty_start[REGFILE_VS_FLOAT4] != program->dirty_end[REGFILE_VS_FLOAT4])
+                program->uniform_slice[0].size = 0;
+            if (program->dirty_start[REGFILE_PS_FLOAT4] != program->dirty_end[REGFILE_PS_FLOAT4])
+                program->uniform_slice[1].size = 0;
+#endif
             ctx->profilePushUniforms();
+            memset(program->dirty_start, '\0', sizeof (program->dirty_start));
+            memset(program->dirty_end, '\0', sizeof (program->dirty_end));
+        } // if
     } // if
+
+#ifdef MOJOSHADER_GLSL_UNIFORM_BUFFERS
+    if (program->uses_uniform_block[0] || program->uses_uniform_block[1])
+        bind_uniform_blocks(program);
+#endif
 } // MOJOSHADER_glProgramReady
 
 
@@ -3015,6 +3853,9 @@ void MOJOSHADER_glDestroyContext(MOJOSHADER_glContext *_ctx)
     MOJOSHADER_glBindProgram(NULL);
     if (ctx->linker_cache)
         hash_destroy(ctx->linker_cache, ctx);
+#ifdef MOJOSHADER_GLSL_UNIFORM_BUFFERS
+    uniform_ring_destroy();
+#endif
     lookup_entry_points(NULL, NULL);   // !!! FIXME: is there a value to this?
     Free(ctx);
     ctx = ((current_ctx == _ctx) ? NULL : current_ctx);
@@ -37,6 +37,39 @@ static void print_debug_lexing_position(IncludeState *s)
 #define print_debug_lexing_position(s)
 #endif
 
+// Growable scratch space, reused for every macro invocation.
+typedef struct ScratchText
+{
+    char *data;
+    size_t len;
+    size_t alloc;
+} ScratchText;
+
+typedef struct MacroArg
+{
+    const char *definition;  // with object-like macros replaced.
+    const char *original;  // as written, for the '#' and '##' operators.
+    unsigned int deflen;
+    unsigned int origlen;
+} MacroArg;
+
+// Shared by every run of one MOJOSHADER_preprocessPermutations() call.
+typedef struct PermutationBatch
+{
+    HashTable *includes;  // filename -> PermutationInclude
+    HashTable *names;  // Define -> index of every predefined macro name.
+    uint64 name_filter;  // bit (hash % 64) is set for each of those names.
+    Define *name_keys;  // just keys for (names), not real macros.
+    unsigned int name_count;
+    int recording;  // note which names the current run looks at?
+    unsigned char *queried;  // name_count flags for the current run.
+    unsigned int *query_list;  // ...and the indices of the ones that are set.
+    unsigned int query_count;
+    MOJOSHADER_malloc m;
+    MOJOSHADER_free f;
+    void *d;
+} PermutationBatch;
+
 typedef struct Context
 {
     int isfail;
@@ -48,13 +81,18 @@ typedef struct Context
     Conditional *conditional_pool;
     IncludeState *include_stack;
     IncludeState *include_pool;
-    Define *define_hashtable[256];
+    HashTable *define_hashtable;  // Define -> Define
     Define *define_pool;
     Define *file_macro;
     Define *line_macro;
+    ScratchText argtext;
+    ScratchText argorigtext;
     StringCache *filename_cache;
     MOJOSHADER_includeOpen open_callback;
     MOJOSHADER_includeClose close_callback;
+    MOJOSHADER_includeCache *include_cache;
+    StringMap *include_guards;  // filename -> guard macro, NULL if #pragma once
+    PermutationBatch *batch;  // non-NULL if preprocessing permutations.
     MOJOSHADER_malloc malloc;
     MOJOSHADER_free free;
     void *malloc_data;
@@ -81,6 +119,29 @@ static inline void Free(Context *ctx, void *ptr)
     ctx->free(ptr, ctx->malloc_data);
 } // Free
 
+static int scratch_append(Context *ctx, ScratchText *text,
+                          const char *data, const size_t len)
+{
+    if ((text->len + len) > text->alloc)
+    {
+        size_t newalloc = (text->alloc > 0) ? (text->alloc * 2) : 256;
+        while (newalloc < (text->len + len))
+            newalloc *= 2;
+        char *ptr = (char *) Malloc(ctx, newalloc);
+        if (ptr == NULL)
+            return 0;
+        if (text->len > 0)
+            memcpy(ptr, text->data, text->len);
+        Free(ctx, text->data);
+        text->data = ptr;
+        text->alloc = newalloc;
+    } // if
+
+    memcpy(text->data + text->len, data, len);
+    text->len += len;
+    return 1;
+} // scratch_append
+
 static void *MallocBridge(int bytes, void *data)
 {
     return Malloc((Context *) data, (size_t) bytes);
@@ -210,44 +271,43 @@ void MOJOSHADER_print_debug_token(const char *subsystem, const char *token,
 #include <unistd.h>
 #endif
 
-int MOJOSHADER_internal_include_open(MOJOSHADER_includeType inctype,
-                                     const char *fname, const char *parent,
-                                     const char **outdata,
-                                     unsigned int *outbytes,
-                                     MOJOSHADER_malloc m, MOJOSHADER_free f,
-                                     void *d)
+// Read all of (fname) into a new buffer, after (prefix) bytes that are left
+//  for the caller. Returns NULL on failure.
+static char *read_include(const char *fname, const size_t prefix,
+                          unsigned int *_len, MOJOSHADER_malloc m,
+                          MOJOSHADER_free f, void *d)
 {
 #ifdef _WIN32
     WCHAR wpath[MAX_PATH];
     if (!MultiByteToWideChar(CP_UTF8, 0, fname, -1, wpath, MAX_PATH))
-        return 0;
+        return NULL;
 
     const DWORD share = FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE;
     const HANDLE handle = CreateFileW(wpath, FILE_GENERIC_READ, share,
                                       NULL, OPEN_EXISTING, NULL, NULL);
     if (handle == INVALID_HANDLE_VALUE)
-        return 0;
+        return NULL;
 
     const DWORD fileSize = GetFileSize(handle, NULL);
     if (fileSize == INVALID_FILE_SIZE)
     {
         CloseHandle(handle);
-        return 0;
+        return NULL;
     } // if
 
-    char *data = (char *) m(fileSize, d);
+    char *data = (char *) m((int) (prefix + fileSize), d);
     if (data == NULL)
     {
         CloseHandle(handle);
-        return 0;
+        return NULL;
     } // if
 
     DWORD readLength = 0;
-    if (!ReadFile(handle, data, fileSize, &readLength, NULL))
+    if (!ReadFile(handle, data + prefix, fileSize, &readLength, NULL))
     {
         CloseHandle(handle);
         f(data, d);
-        return 0;
+        return NULL;
     } // if
 
     CloseHandle(handle);
@@ -255,35 +315,50 @@ int MOJOSHADER_internal_include_open(MOJOSHADER_includeType inctype,
     if (readLength != fileSize)
     {
         f(data, d);
-        return 0;
+        return NULL;
     } // if
-    *outdata = data;
-    *outbytes = fileSize;
-    return 1;
+    *_len = fileSize;
+    return data;
 #else
     struct stat statbuf;
     if (stat(fname, &statbuf) == -1)
-        return 0;
-    char *data = (char *) m(statbuf.st_size, d);
+        return NULL;
+    char *data = (char *) m((int) (prefix + statbuf.st_size), d);
     if (data == NULL)
-        return 0;
+        return NULL;
     const int fd = open(fname, O_RDONLY);
     if (fd == -1)
     {
         f(data, d);
-        return 0;
+        return NULL;
     } // if
-    if (read(fd, data, statbuf.st_size) != statbuf.st_size)
+    if (read(fd, data + prefix, statbuf.st_size) != statbuf.st_size)
     {
         f(data, d);
         close(fd);
-        return 0;
+        return NULL;
     } // if
     close(fd);
+    *_len = (unsigned int) statbuf.st_size;
+    return data;
+#endif
+} // read_include
+
+
+int MOJOSHADER_internal_include_open(MOJOSHADER_includeType inctype,
+                                     const char *fname, const char *parent,
+                                     const char **outdata,
+                                     unsigned int *outbytes,
+                                     MOJOSHADER_malloc m, MOJOSHADER_free f,
+                                     void *d)
+{
+    unsigned int len = 0;
+    char *data = read_include(fname, 0, &len, m, f, d);
+    if (data == NULL)
+        return 0;
     *outdata = data;
-    *outbytes = (unsigned int) statbuf.st_size;
+    *outbytes = len;
     return 1;
-#endif
 } // MOJOSHADER_internal_include_open
 
 
@@ -292,6 +367,260 @@ void MOJOSHADER_internal_include_close(const char *data, MOJOSHADER_malloc m,
 {
     f((void *) data, d);
 } // MOJOSHADER_internal_include_close
+
+
+// The include cache...
+
+// What we check to decide if a cached file is still current.
+typedef struct IncludeStamp
+{
+    uint64 size;
+    uint64 mtime;
+    uint64 mtime_nsec;  // so two writes in the same second still differ.
+    uint64 device;
+    uint64 inode;
+} IncludeStamp;
+
+// One version of a file's contents, which follow this header. The cache
+//  holds a reference while it's current, and so does every #include using
+//  it, so a reload doesn't pull the data out from under another thread.
+typedef struct IncludeBlob
+{
+    volatile int refcount;
+    MOJOSHADER_free f;
+    void *d;
+} IncludeBlob;
+
+typedef struct IncludeEntry
+{
+    const char *path;  // allocated with the entry.
+    IncludeStamp stamp;
+    IncludeBlob *blob;
+    unsigned int len;
+} IncludeEntry;
+
+struct MOJOSHADER_includeCache
+{
+    HashTable *files;  // path -> IncludeEntry
+    Mutex *mutex;
+    MOJOSHADER_includeCacheStats stats;
+    MOJOSHADER_malloc m;
+    MOJOSHADER_free f;
+    void *d;
+};
+
+static int stamp_include(const char *fname, IncludeStamp *stamp)
+{
+#ifdef _WIN32
+    WCHAR wpath[MAX_PATH];
+    WIN32_FILE_ATTRIBUTE_DATA attr;
+    if (!MultiByteToWideChar(CP_UTF8, 0, fname, -1, wpath, MAX_PATH))
+        return 0;
+    else if (!GetFileAttributesExW(wpath, GetFileExInfoStandard, &attr))
+        return 0;
+    stamp->size = (((uint64) attr.nFileSizeHigh) << 32) | attr.nFileSizeLow;
+    stamp->mtime = (((uint64) attr.ftLastWriteTime.dwHighDateTime) << 32) |
+                   attr.ftLastWriteTime.dwLowDateTime;
+    stamp->mtime_nsec = 0;  // FILETIME is already in 100ns units.
+    stamp->device = 0;
+    stamp->inode = 0;
+#else
+    struct stat statbuf;
+    if (stat(fname, &statbuf) == -1)
+        return 0;
+    stamp->size = (uint64) statbuf.st_size;
+    stamp->mtime = (uint64) statbuf.st_mtime;
+#if defined(__APPLE__)
+    stamp->mtime_nsec = (uint64) statbuf.st_mtimespec.tv_nsec;
+#elif defined(__linux__)
+    stamp->mtime_nsec = (uint64) statbuf.st_mtim.tv_nsec;
+#else
+    stamp->mtime_nsec = 0;  // size, device and inode will have to do.
+#endif
+    stamp->device = (uint64) statbuf.st_dev;
+    stamp->inode = (uint64) statbuf.st_ino;
+#endif
+    return 1;
+} // stamp_include
+
+static inline int same_stamp(const IncludeStamp *a, const IncludeStamp *b)
+{
+    return ( (a->size == b->size) && (a->mtime == b->mtime) &&
+             (a->mtime_nsec == b->mtime_nsec) &&
+             (a->device == b->device) && (a->inode == b->inode) );
+} // same_stamp
+
+static void release_include_blob(IncludeBlob *blob)
+{
+    if (atomic_add(&blob->refcount, -1) == 1)
+        blob->f(blob, blob->d);
+} // release_include_blob
+
+static void nuke_include_entry(const void *ctx, const void *key,
+                               const void *value, void *data)
+{
+    MOJOSHADER_includeCache *cache = (MOJOSHADER_includeCache *) data;
+    IncludeEntry *entry = (IncludeEntry *) value;
+    cache->stats.files--;
+    cache->stats.bytes -= entry->len;
+    release_include_blob(entry->blob);
+    cache->f(entry, cache->d);
+} // nuke_include_entry
+
+static int include_cache_open(MOJOSHADER_includeCache *cache,
+                              const char *fname, const char **outdata,
+                              unsigned int *outbytes)
+{
+    const void *value = NULL;
+    IncludeStamp stamp;
+    unsigned int len = 0;
+
+    if (!stamp_include(fname, &stamp))
+        return 0;
+
+    mutex_lock(cache->mutex);
+    if (hash_find(cache->files, fname, &value))
+    {
+        const IncludeEntry *entry = (const IncludeEntry *) value;
+        if (same_stamp(&entry->stamp, &stamp))
+        {
+            cache->stats.hits++;
+            atomic_add(&entry->blob->refcount, 1);
+            *outdata = (const char *) (entry->blob + 1);
+            *outbytes = entry->len;
+            mutex_unlock(cache->mutex);
+            return 1;
+        } // if
+        cache->stats.reloads++;
+    } // if
+    cache->stats.misses++;
+    mutex_unlock(cache->mutex);
+
+    // Read it without the lock held, so hits on other threads don't wait
+    //  for the disk. If two threads miss on the same file at once, they
+    //  both read it, and the last one in stays cached.
+    IncludeBlob *blob = (IncludeBlob *) read_include(fname,
+                            sizeof (IncludeBlob), &len,
+                            cache->m, cache->f, cache->d);
+    if (blob == NULL)
+        return 0;
+
+    blob->refcount = 1;
+    blob->f = cache->f;
+    blob->d = cache->d;
+    *outdata = (const char *) (blob + 1);
+    *outbytes = len;
+
+    const size_t pathlen = strlen(fname) + 1;
+    IncludeEntry *entry = (IncludeEntry *) cache->m(
+                            (int) (sizeof (IncludeEntry) + pathlen), cache->d);
+    if (entry == NULL)
+        return 1;  // we still have the file, it just won't be cached.
+
+    memcpy(entry + 1, fname, pathlen);
+    entry->path = (const char *) (entry + 1);
+    entry->stamp = stamp;
+    entry->blob = blob;
+    entry->len = len;
+    blob->refcount = 2;
+
+    mutex_lock(cache->mutex);
+    hash_remove(cache->files, fname, NULL);
+    if (hash_insert(cache->files, entry->path, entry) == 1)
+    {
+        cache->stats.files++;
+        cache->stats.bytes += len;
+    } // if
+    else
+    {
+        blob->refcount = 1;
+        cache->f(entry, cache->d);
+    } // else
+    mutex_unlock(cache->mutex);
+
+    return 1;
+} // include_cache_open
+
+static void include_cache_close(const char *data, MOJOSHADER_malloc m,
+                                MOJOSHADER_free f, void *d)
+{
+    release_include_blob(((IncludeBlob *) data) - 1);
+} // include_cache_close
+
+
+MOJOSHADER_includeCache *MOJOSHADER_createIncludeCache(MOJOSHADER_malloc m,
+                                                       MOJOSHADER_free f,
+                                                       void *d)
+{
+    if (!m) m = MOJOSHADER_internal_malloc;
+    if (!f) f = MOJOSHADER_internal_free;
+
+    MOJOSHADER_includeCache *cache = (MOJOSHADER_includeCache *)
+                                    m(sizeof (MOJOSHADER_includeCache), d);
+    if (cache == NULL)
+        return NULL;
+
+    memset(cache, '\0', sizeof (MOJOSHADER_includeCache));
+    cache->m = m;
+    cache->f = f;
+    cache->d = d;
+    cache->files = hash_create(cache, hash_hash_string, hash_keymatch_string,
+                               nuke_include_entry, 0, m, f, d);
+    cache->mutex = mutex_create(m, f, d);
+
+    #ifdef MOJOSHADER_NO_THREADS
+    const int need_mutex = 0;
+    #else
+    const int need_mutex = 1;
+    #endif
+
+    if ((cache->files == NULL) || ((need_mutex) && (cache->mutex == NULL)))
+    {
+        MOJOSHADER_destroyIncludeCache(cache);
+        return NULL;
+    } // if
+
+    return cache;
+} // MOJOSHADER_createIncludeCache
+
+
+void MOJOSHADER_getIncludeCacheStats(MOJOSHADER_includeCache *cache,
+                                     MOJOSHADER_includeCacheStats *stats)
+{
+    mutex_lock(cache->mutex);
+    memcpy(stats, &cache->stats, sizeof (MOJOSHADER_includeCacheStats));
+    mutex_unlock(cache->mutex);
+} // MOJOSHADER_getIncludeCacheStats
+
+
+void MOJOSHADER_destroyIncludeCache(MOJOSHADER_includeCache *cache)
+{
+    if (cache == NULL)
+        return;
+
+    if (cache->files != NULL)
+        hash_destroy(cache->files, NULL);
+    mutex_destroy(cache->mutex);
+    cache->f(cache, cache->d);
+} // MOJOSHADER_destroyIncludeCache
+
+#else  // MOJOSHADER_FORCE_INCLUDE_CALLBACKS
+
+// We never open files ourselves, so there's nothing to cache.
+MOJOSHADER_includeCache *MOJOSHADER_createIncludeCache(MOJOSHADER_malloc m,
+                                                       MOJOSHADER_free f,
+                                                       void *d)
+{
+    return NULL;
+} // MOJOSHADER_createIncludeCache
+
+void MOJOSHADER_getIncludeCacheStats(MOJOSHADER_includeCache *cache,
+                                     MOJOSHADER_includeCacheStats *stats)
+{
+    memset(stats, '\0', sizeof (MOJOSHADER_includeCacheStats));
+} // MOJOSHADER_getIncludeCacheStats
+
+void MOJOSHADER_destroyIncludeCache(MOJOSHADER_includeCache *cache) {}
 #endif  // !MOJOSHADER_FORCE_INCLUDE_CALLBACKS
 
 
@@ -340,50 +669,116 @@ IMPLEMENT_POOL(Define, define)
 
 // Preprocessor define hashtable stuff...
 
-// !!! FIXME: why isn't this using mojoshader_common.c's code?
+// The table's keys are the Defines themselves, so we can look one up
+//  straight from a token, without copying it somewhere to NULL-terminate it.
+//  Each key carries its hash, so a lookup only hashes the identifier once.
 
 // this is djb's xor hashing function.
-static inline uint32 hash_string_djbxor(const char *sym)
+static inline uint32 hash_string_djbxor(const char *sym, unsigned int len)
 {
     register uint32 hash = 5381;
-    while (*sym)
+    while (len--)
         hash = ((hash << 5) + hash) ^ *(sym++);
     return hash;
 } // hash_string_djbxor
 
-static inline uint8 hash_define(const char *sym)
+static uint32 hash_define(const void *key, void *data)
 {
-    return (uint8) hash_string_djbxor(sym);
+    return ((const Define *) key)->identifier_hash;
 } // hash_define
 
+static inline void init_define_key(Define *key, const char *sym,
+                                   const unsigned int len)
+{
+    key->identifier = sym;
+    key->identifier_len = len;
+    key->identifier_hash = hash_string_djbxor(sym, len);
+} // init_define_key
+
+static int keymatch_define(const void *a, const void *b, void *data)
+{
+    const Define *adef = (const Define *) a;
+    const Define *bdef = (const Define *) b;
+    return ( (adef->identifier_len == bdef->identifier_len) &&
+             (memcmp(adef->identifier, bdef->identifier,
+                     adef->identifier_len) == 0) );
+} // keymatch_define
+
+static void close_define_include(const char *data, MOJOSHADER_malloc m,
+                                 MOJOSHADER_free f, void *d);
+
+// Remember that this permutation's output depends on (key)'s definition.
+static void note_define_query(Context *ctx, const Define *key)
+{
+    PermutationBatch *batch = ctx->batch;
+    const IncludeState *state = ctx->include_stack;
+    const void *value = NULL;
+    const uint64 bit = ((uint64) 1) << (key->identifier_hash & 63);
+
+    if ((batch->name_filter & bit) == 0)
+        return;  // definitely not one of the permutations' names.
+
+    // the permutation's own #defines don't count, just the source's lookups.
+    if ((state != NULL) && (state->close_callback == close_define_include))
+        return;
+
+    if (hash_find(batch->names, key, &value))
+    {
+        const unsigned int idx = (unsigned int) (size_t) value;
+        if (!batch->queried[idx])
+        {
+            batch->queried[idx] = 1;
+            batch->query_list[batch->query_count++] = idx;
+        } // if
+    } // if
+} // note_define_query
+
+static inline int recording_queries(const Context *ctx)
+{
+    return ((ctx->batch != NULL) && (ctx->batch->recording));
+} // recording_queries
+
+static void free_define(Context *ctx, Define *def);
+
+static void nuke_define(const void *ctx, const void *key, const void *value,
+                        void *data)
+{
+    free_define((Context *) data, (Define *) key);
+} // nuke_define
+
 
 static int add_define(Context *ctx, const char *sym, const char *val,
-                      char **parameters, int paramcount)
+                      char **parameters, int paramcount,
+                      MacroToken *tokens, unsigned int tokencount)
 {
-    const uint8 hash = hash_define(sym);
-    Define *bucket = ctx->define_hashtable[hash];
-    while (bucket)
+    Define *def = get_define(ctx);
+    if (def == NULL)
+        return 0;
+
+    init_define_key(def, sym, (unsigned int) strlen(sym));
+    def->definition = val;
+    def->parameters = (const char **) parameters;
+    def->paramcount = paramcount;
+    def->tokens = tokens;
+    def->tokencount = tokencount;
+
+    if (recording_queries(ctx))
+        note_define_query(ctx, def);
+
+    const int rc = hash_insert(ctx->define_hashtable, def, def);
+    if (rc <= 0)
     {
-        if (strcmp(bucket->identifier, sym) == 0)
+        put_define(ctx, def);  // caller still owns everything else.
+        if (rc < 0)
+            out_of_memory(ctx);
+        else
         {
             failf(ctx, "'%s' already defined", sym); // !!! FIXME: warning?
             // !!! FIXME: gcc reports the location of previous #define here.
-            return 0;
-        } // if
-        bucket = bucket->next;
-    } // while
-
-    bucket = get_define(ctx);
-    if (bucket == NULL)
+        } // else
         return 0;
+    } // if
 
-    bucket->definition = val;
-    bucket->original = NULL;
-    bucket->identifier = sym;
-    bucket->parameters = (const char **) parameters;
-    bucket->paramcount = paramcount;
-    bucket->next = ctx->define_hashtable[hash];
-    ctx->define_hashtable[hash] = bucket;
     return 1;
 } // add_define
 
@@ -398,7 +793,7 @@ static void free_define(Context *ctx, Define *def)
         Free(ctx, (void *) def->parameters);
         Free(ctx, (void *) def->identifier);
         Free(ctx, (void *) def->definition);
-        Free(ctx, (void *) def->original);
+        Free(ctx, def->tokens);
         put_define(ctx, def);
     } // if
 } // free_define
@@ -406,46 +801,26 @@ static void free_define(Context *ctx, Define *def)
 
 static int remove_define(Context *ctx, const char *sym)
 {
-    const uint8 hash = hash_define(sym);
-    Define *bucket = ctx->define_hashtable[hash];
-    Define *prev = NULL;
-    while (bucket)
-    {
-        if (strcmp(bucket->identifier, sym) == 0)
-        {
-            if (prev == NULL)
-                ctx->define_hashtable[hash] = bucket->next;
-            else
-                prev->next = bucket->next;
-            free_define(ctx, bucket);
-            return 1;
-        } // if
-        prev = bucket;
-        bucket = bucket->next;
-    } // while
-
-    return 0;
+    Define key;
+    init_define_key(&key, sym, (unsigned int) strlen(sym));
+    if (recording_queries(ctx))
+        note_define_query(ctx, &key);
+    return hash_remove(ctx->define_hashtable, &key, ctx);
 } // remove_define
 
 
-static const Define *find_define(Context *ctx, const char *sym)
+static const Define *find_define_len(Context *ctx, const char *sym,
+                                     const unsigned int symlen)
 {
-    const uint8 hash = hash_define(sym);
-    Define *bucket = ctx->define_hashtable[hash];
-    while (bucket)
-    {
-        if (strcmp(bucket->identifier, sym) == 0)
-            return bucket;
-        bucket = bucket->next;
-    } // while
-
-    const uint8 filestrhash = 67;
-    assert(hash_define("__FILE__") == filestrhash);
-
-    const uint8 linestrhash = 75;
-    assert(hash_define("__LINE__") == linestrhash);
+    const void *value = NULL;
+    Define key;
+    init_define_key(&key, sym, symlen);
+    if (recording_queries(ctx))
+        note_define_query(ctx, &key);
+    if (hash_find(ctx->define_hashtable, &key, &value))
+        return (const Define *) value;
 
-    if ( (hash == filestrhash) && (ctx->file_macro) && (strcmp(sym, "__FILE__") == 0) )
+    if ( (symlen == 8) && (ctx->file_macro) && (memcmp(sym, "__FILE__", 8) == 0) )
     {
         Free(ctx, (char *) ctx->file_macro->definition);
         const IncludeState *state = ctx->include_stack;
@@ -462,7 +837,7 @@ static const Define *find_define(Context *ctx, const char *sym)
         return ctx->file_macro;
     } // if
 
-    else if ( (hash == linestrhash) && (ctx->line_macro) && (strcmp(sym, "__LINE__") == 0) )
+    else if ( (symlen == 8) && (ctx->line_macro) && (memcmp(sym, "__LINE__", 8) == 0) )
     {
         Free(ctx, (char *) ctx->line_macro->definition);
         const IncludeState *state = ctx->include_stack;
@@ -478,54 +853,41 @@ static const Define *find_define(Context *ctx, const char *sym)
     } // else
 
     return NULL;
+} // find_define_len
+
+
+static inline const Define *find_define(Context *ctx, const char *sym)
+{
+    return find_define_len(ctx, sym, (unsigned int) strlen(sym));
 } // find_define
 
 
-static const Define *find_define_by_token(Context *ctx)
+static inline const Define *find_define_by_token(Context *ctx)
 {
     IncludeState *state = ctx->include_stack;
     assert(state->tokenval == TOKEN_IDENTIFIER);
-    char *sym = (char *) alloca(state->tokenlen+1);
-    memcpy(sym, state->token, state->tokenlen);
-    sym[state->tokenlen] = '\0';
-    return find_define(ctx, sym);
+    return find_define_len(ctx, state->token, state->tokenlen);
 } // find_define_by_token
 
 
-static const Define *find_macro_arg(const IncludeState *state,
-                                    const Define *defines)
+static const MacroArg *find_macro_arg(const IncludeState *state,
+                                      const MacroArg *args)
 {
-    const Define *def = NULL;
-    char *sym = (char *) alloca(state->tokenlen + 1);
-    memcpy(sym, state->token, state->tokenlen);
-    sym[state->tokenlen] = '\0';
-
-    for (def = defines; def != NULL; def = def->next)
-    {
-        assert(def->parameters == NULL);  // args can't have args!
-        assert(def->paramcount == 0);  // args can't have args!
-        if (strcmp(def->identifier, sym) == 0)
-            break;
-    } // while
-
-    return def;
+    // parameter names were resolved to slots when the macro was #defined.
+    assert(state->macro_tokens != NULL);
+    assert(state->macro_tokenpos > 0);
+    const int param = state->macro_tokens[state->macro_tokenpos - 1].param;
+    return (param < 0) ? NULL : &args[param];
 } // find_macro_arg
 
 
 static void put_all_defines(Context *ctx)
 {
-    size_t i;
-    for (i = 0; i < STATICARRAYLEN(ctx->define_hashtable); i++)
+    if (ctx->define_hashtable != NULL)
     {
-        Define *bucket = ctx->define_hashtable[i];
-        ctx->define_hashtable[i] = NULL;
-        while (bucket)
-        {
-            Define *next = bucket->next;
-            free_define(ctx, bucket);
-            bucket = next;
-        } // while
-    } // for
+        hash_destroy(ctx->define_hashtable, ctx);
+        ctx->define_hashtable = NULL;
+    } // if
 } // put_all_defines
 
 
@@ -566,6 +928,53 @@ static int push_source(Context *ctx, const char *fname, const char *source,
 } // push_source
 
 
+// Push pre-lexed tokens as if they were a new source, for macro expansion.
+static int push_macro_tokens(Context *ctx, const char *source,
+                             unsigned int srclen, const MacroToken *tokens,
+                             unsigned int tokencount,
+                             MOJOSHADER_includeClose close_callback)
+{
+    IncludeState *parent = ctx->include_stack;
+    assert(parent != NULL);
+    assert(tokens != NULL);
+
+    IncludeState *state = get_include(ctx);
+    if (state == NULL)
+        return 0;
+
+    // parent's filename is already in the cache; don't look it up again.
+    state->filename = parent->filename;
+    state->close_callback = close_callback;
+    state->source_base = source;
+    state->source = source + srclen;
+    state->token = source;
+    state->tokenval = ((Token) '\n');
+    state->orig_length = srclen;
+    state->bytes_left = 0;  // the lexer never sees this source.
+    state->line = parent->line;
+    state->macro_tokens = tokens;
+    state->macro_tokencount = tokencount;
+    state->next = parent;
+    state->asm_comments = ctx->asm_comments;
+
+    print_debug_lexing_position(state);
+
+    ctx->include_stack = state;
+
+    return 1;
+} // push_macro_tokens
+
+
+static int push_macro_source(Context *ctx, const Define *def)
+{
+    const MacroToken *last = &def->tokens[def->tokencount - 1];
+    const unsigned int srclen = (unsigned int)
+                ((last->token + last->tokenlen) - def->definition);
+    return push_macro_tokens(ctx, def->definition, srclen, def->tokens,
+                             def->tokencount, NULL);
+} // push_macro_source
+
+
 static void pop_source(Context *ctx)
 {
     IncludeState *state = ctx->include_stack;
@@ -604,10 +1013,36 @@ static void close_define_include(const char *data, MOJOSHADER_malloc m,
 } // close_define_include
 
 
+// What we remember an #included file by, in (buf), or NULL if we can't tell
+//  it's the same file the next time we see (filename). The built-in reader
+//  and the include cache only look at (filename), but an app's callbacks
+//  might resolve it against (parent) or depend on (incltype), so for those
+//  the key has all three. Parent data can be freed and its address reused
+//  by another file, though, so that's only safe in a batch, which keeps
+//  every file open until it's done.
+static const char *include_key(Context *ctx,
+                               const MOJOSHADER_includeType incltype,
+                               const char *filename, const char *parent,
+                               char *buf, const size_t buflen)
+{
+    #if !MOJOSHADER_FORCE_INCLUDE_CALLBACKS
+    if (ctx->open_callback == MOJOSHADER_internal_include_open)
+        return filename;  // the include cache is only used with this, too.
+    #endif
+
+    if (ctx->batch == NULL)
+        return NULL;
+
+    snprintf(buf, buflen, "%d:%p:%s", (int) incltype, parent, filename);
+    return buf;
+} // include_key
+
+
 Preprocessor *preprocessor_start(const char *fname, const char *source,
                             unsigned int sourcelen,
                             MOJOSHADER_includeOpen open_callback,
                             MOJOSHADER_includeClose close_callback,
+                            MOJOSHADER_includeCache *include_cache,
                             const MOJOSHADER_preprocessorDefine *defines,
                             unsigned int define_count, int asm_comments,
                             MOJOSHADER_malloc m, MOJOSHADER_free f, void *d)
@@ -631,9 +1066,19 @@ Preprocessor *preprocessor_start(const char *fname, const char *source,
     ctx->close_callback = close_callback;
     ctx->asm_comments = asm_comments;
 
+    #if !MOJOSHADER_FORCE_INCLUDE_CALLBACKS
+    if (open_callback == MOJOSHADER_internal_include_open)
+        ctx->include_cache = include_cache;
+    #endif
+
     ctx->filename_cache = stringcache_create(MallocBridge, FreeBridge, ctx);
     okay = ((okay) && (ctx->filename_cache != NULL));
 
+    ctx->define_hashtable = hash_create(ctx, hash_define, keymatch_define,
+                                        nuke_define, 0, MallocBridge,
+                                        FreeBridge, ctx);
+    okay = ((okay) && (ctx->define_hashtable != NULL));
+
     ctx->file_macro = get_define(ctx);
     okay = ((okay) && (ctx->file_macro != NULL));
     if ((okay) && (ctx->file_macro))
@@ -669,6 +1114,17 @@ Preprocessor *preprocessor_start(const char *fname, const char *source,
     if ((okay) && (!push_source(ctx,fname,source,sourcelen,1,NULL)))
         okay = 0;
 
+    // the main file can "#pragma once" itself, too.
+    if ((okay) && (fname != NULL))
+    {
+        const size_t keylen = strlen(fname) + 64;
+        const char *key = include_key(ctx, MOJOSHADER_INCLUDETYPE_LOCAL,
+                                      fname, NULL, (char *) alloca(keylen),
+                                      keylen);
+        if (key != NULL)
+            ctx->include_stack->guard_key = stringcache(ctx->filename_cache, key);
+    } // if
+
     if ((okay) && (define_include_len > 0))
     {
         assert(define_include != NULL);
@@ -700,8 +1156,13 @@ void preprocessor_end(Preprocessor *_ctx)
     if (ctx->filename_cache != NULL)
         stringcache_destroy(ctx->filename_cache);
 
+    if (ctx->include_guards != NULL)
+        stringmap_destroy(ctx->include_guards);
+
     free_define(ctx, ctx->file_macro);
     free_define(ctx, ctx->line_macro);
+    Free(ctx, ctx->argtext.data);
+    Free(ctx, ctx->argorigtext.data);
     free_define_pool(ctx);
     free_conditional_pool(ctx);
     free_include_pool(ctx);
@@ -727,10 +1188,37 @@ static inline void pushback(IncludeState *state)
 } // pushback
 
 
+static Token macro_lexer(IncludeState *state)
+{
+    const MacroToken *tok = NULL;
+    do
+    {
+        if (state->macro_tokenpos == state->macro_tokencount)
+        {
+            state->token = state->source;
+            state->tokenlen = 0;
+            state->tokenval = TOKEN_EOI;
+            return TOKEN_EOI;
+        } // if
+
+        tok = &state->macro_tokens[state->macro_tokenpos++];
+    } while ((tok->tokenval == ((Token) ' ')) && (!state->report_whitespace));
+
+    state->token = tok->token;
+    state->tokenlen = tok->tokenlen;
+    state->tokenval = tok->tokenval;
+    return tok->tokenval;
+} // macro_lexer
+
+
 static Token lexer(IncludeState *state)
 {
     if (!state->pushedback)
+    {
+        if (state->macro_tokens != NULL)
+            return macro_lexer(state);
         return preprocessor_lexer(state);
+    } // if
     state->pushedback = 0;
     return state->tokenval;
 } // lexer
@@ -756,6 +1244,155 @@ static int token_to_int(IncludeState *state)
 } // token_to_int
 
 
+static int open_include(Context *ctx, const MOJOSHADER_includeType incltype,
+                        const char *filename, const char *parent,
+                        const char **outdata, unsigned int *outbytes,
+                        MOJOSHADER_includeClose *closefn)
+{
+    #if !MOJOSHADER_FORCE_INCLUDE_CALLBACKS
+    if (ctx->include_cache != NULL)
+    {
+        *closefn = include_cache_close;
+        return include_cache_open(ctx->include_cache, filename,
+                                  outdata, outbytes);
+    } // if
+    #endif
+
+    *closefn = ctx->close_callback;
+    return ctx->open_callback(incltype, filename, parent, outdata, outbytes,
+                              ctx->malloc, ctx->free, ctx->malloc_data);
+} // open_include
+
+
+// Every permutation in a batch uses the same copy of each #included file.
+//  The batch owns them, and closes them all when it's done.
+typedef struct PermutationInclude
+{
+    const char *data;
+    unsigned int len;
+    MOJOSHADER_includeClose close_callback;
+    // the include_key() follows this struct in memory.
+} PermutationInclude;
+
+static int batch_include_open(Context *ctx, const char *key,
+                              const MOJOSHADER_includeType incltype,
+                              const char *filename, const char *parent,
+                              const char **outdata, unsigned int *outbytes)
+{
+    HashTable *includes = ctx->batch->includes;
+    const void *value = NULL;
+    if (hash_find(includes, key, &value))
+    {
+        const PermutationInclude *incl = (const PermutationInclude *) value;
+        *outdata = incl->data;
+        *outbytes = incl->len;
+        return 1;
+    } // if
+
+    MOJOSHADER_includeClose closefn = NULL;
+    if (!open_include(ctx, incltype, filename, parent, outdata, outbytes, &closefn))
+        return 0;
+
+    const size_t keylen = strlen(key) + 1;
+    PermutationInclude *incl;
+    incl = (PermutationInclude *) Malloc(ctx, sizeof (*incl) + keylen);
+    if (incl != NULL)
+    {
+        char *name = (char *) (incl + 1);
+        memcpy(name, key, keylen);
+        incl->data = *outdata;
+        incl->len = *outbytes;
+        incl->close_callback = closefn;
+        if (hash_insert(includes, name, incl) == 1)
+            return 1;
+        Free(ctx, incl);
+        out_of_memory(ctx);
+    } // if
+
+    closefn(*outdata, ctx->malloc, ctx->free, ctx->malloc_data);
+    return 0;
+} // batch_include_open
+
+static void batch_include_close(const char *data, MOJOSHADER_malloc m,
+                                MOJOSHADER_free f, void *d)
+{
+    // no-op, the batch closes it later.
+} // batch_include_close
+
+
+// Multiple-inclusion guards...
+//
+// A file whose first directive is "#ifndef X", whose matching #endif is the
+//  last thing in it, can't produce anything while X is defined. Once we've
+//  seen a file like that, we don't open it again until X is undefined. A
+//  file with "#pragma once" in it is never opened again at all. Files are
+//  remembered by include_key(), so we only do this for files it can name.
+
+static void remember_include_guard(Context *ctx, const char *key,
+                                   const char *guard)
+{
+    if (ctx->include_guards == NULL)
+    {
+        ctx->include_guards = stringmap_create(1, MallocBridge, FreeBridge, ctx);
+        if (ctx->include_guards == NULL)
+            return;
+    } // if
+
+    // this fails harmlessly if the file is already in there.
+    stringmap_insert(ctx->include_guards, key, guard);
+} // remember_include_guard
+
+static int include_is_guarded(Context *ctx, const char *key)
+{
+    const char *guard = NULL;
+    if ((ctx->include_guards == NULL) || (key == NULL))
+        return 0;
+    else if (!stringmap_find(ctx->include_guards, key, &guard))
+        return 0;
+    return ((guard == NULL) || (find_define(ctx, guard) != NULL));
+} // include_is_guarded
+
+// Called with every token but newlines from a file we're watching.
+static void track_include_guard(Context *ctx, IncludeState *state,
+                                const Token token)
+{
+    switch (state->guard_state)
+    {
+        case INCLUDE_GUARD_START:
+            if (token != TOKEN_PP_IFNDEF)  // _handle_pp_ifdef() does the rest.
+                state->guard_state = INCLUDE_GUARD_NONE;
+            break;
+
+        case INCLUDE_GUARD_INSIDE:
+            if ((token == TOKEN_EOI) || (token == TOKEN_PP_LINE))
+                state->guard_state = INCLUDE_GUARD_NONE;
+            else if (state->conditional_stack != state->guard_conditional)
+                break;  // something nested in the guard, that's fine.
+            else if (token == TOKEN_PP_ENDIF)
+                state->guard_state = INCLUDE_GUARD_CLOSED;
+            else if ((token == TOKEN_PP_ELSE) || (token == TOKEN_PP_ELIF))
+                state->guard_state = INCLUDE_GUARD_NONE;
+            break;
+
+        case INCLUDE_GUARD_CLOSED:
+            // the #endif might have been bogus and left the guard open.
+            if ((token != TOKEN_EOI) || (state->conditional_stack != NULL))
+                state->guard_state = INCLUDE_GUARD_NONE;
+            else
+            {
+                const unsigned int len = state->guard_macrolen;
+                char *guard = (char *) alloca(len + 1);
+                memcpy(guard, state->guard_macro, len);
+                guard[len] = '\0';
+                remember_include_guard(ctx, state->guard_key, guard);
+            } // else
+            break;
+
+        default: break;
+    } // switch
+} // track_include_guard
+
+
 static void handle_pp_include(Context *ctx)
 {
     IncludeState *state = ctx->include_stack;
@@ -808,6 +1445,13 @@ static void handle_pp_include(Context *ctx)
         return;
     } // else
 
+    const char *parent = state->source_base;
+    const size_t keylen = strlen(filename) + 64;
+    const char *key = include_key(ctx, incltype, filename, parent,
+                                  (char *) alloca(keylen), keylen);
+    if (include_is_guarded(ctx, key))
+        return;  // it would come out empty, don't bother opening it.
+
     const char *newdata = NULL;
     unsigned int newbytes = 0;
     if ((ctx->open_callback == NULL) || (ctx->close_callback == NULL))
@@ -816,20 +1460,39 @@ static void handle_pp_include(Context *ctx)
         return;
     } // if
 
-    if (!ctx->open_callback(incltype, filename, state->source_base,
-                            &newdata, &newbytes, ctx->malloc,
-                            ctx->free, ctx->malloc_data))
+    int okay = 0;
+    MOJOSHADER_includeClose callback = NULL;
+    if (ctx->batch != NULL)
+    {
+        okay = batch_include_open(ctx, key, incltype, filename, parent,
+                                  &newdata, &newbytes);
+        callback = batch_include_close;
+    } // if
+    else
+    {
+        okay = open_include(ctx, incltype, filename, parent,
+                            &newdata, &newbytes, &callback);
+    } // else
+
+    if (!okay)
     {
         fail(ctx, "Include callback failed");  // !!! FIXME: better error
         return;
     } // if
 
-    MOJOSHADER_includeClose callback = ctx->close_callback;
     if (!push_source(ctx, filename, newdata, newbytes, 1, callback))
     {
         assert(ctx->out_of_memory);
-        ctx->close_callback(newdata, ctx->malloc, ctx->free, ctx->malloc_data);
+        callback(newdata, ctx->malloc, ctx->free, ctx->malloc_data);
     } // if
+    else if (key != NULL)
+    {
+        // (key) might be on the stack; keep it as long as the filenames.
+        state = ctx->include_stack;
+        state->guard_key = stringcache(ctx->filename_cache, key);
+        if (state->guard_key != NULL)
+            state->guard_state = INCLUDE_GUARD_START;
+    } // else if
 } // handle_pp_include
 
 
@@ -929,6 +1592,87 @@ static void handle_pp_error(Context *ctx)
 } // handle_pp_error
 
 
+// Lex a #define's replacement list once, so expanding the macro can replay
+//  the tokens instead of running the lexer over the text again. Parameter
+//  names are resolved to their slot here, too. Returns NULL for an empty
+//  list, or one that has to go through the lexer when expanded.
+static MacroToken *tokenize_define(Context *ctx, const char *definition,
+                                   char **idents, const int params,
+                                   unsigned int *_count)
+{
+    const unsigned int len = (unsigned int) strlen(definition);
+    MacroToken *retval = NULL;
+    unsigned int count = 0;
+    Token first = TOKEN_EOI;
+    IncludeState state;
+    int pass;
+    int i;
+
+    *_count = 0;
+
+    // first pass counts the tokens, second pass fills them in.
+    for (pass = 0; pass < 2; pass++)
+    {
+        memset(&state, '\0', sizeof (IncludeState));
+        state.source_base = definition;
+        state.source = definition;
+        state.token = definition;
+        state.tokenval = ((Token) '\n');
+        state.orig_length = len;
+        state.bytes_left = len;
+        state.report_whitespace = 1;
+        state.asm_comments = ctx->asm_comments;
+
+        count = 0;
+        while (preprocessor_lexer(&state) != TOKEN_EOI)
+        {
+            if (retval != NULL)
+            {
+                MacroToken *tok = &retval[count];
+                tok->tokenval = state.tokenval;
+                tok->token = state.token;
+                tok->tokenlen = state.tokenlen;
+                tok->param = -1;
+
+                if (state.tokenval == TOKEN_IDENTIFIER)
+                {
+                    // backwards, so a repeated name gets the last.
+                    for (i = params - 1; i >= 0; i--)
+                    {
+                        const char *ident = idents[i];
+                        if ( (strncmp(ident, state.token, state.tokenlen) == 0) &&
+                             (ident[state.tokenlen] == '\0') )
+                        {
+                            tok->param = i;
+                            break;
+                        } // if
+                    } // for
+                } // if
+            } // if
+            else if (count == 0)
+                first = state.tokenval;
+            count++;
+        } // while
+
+        if ((retval != NULL) || (count == 0))
+            break;
+
+        // "#define x #include" is a directive when it's expanded, so let
+        //  the lexer see that one as a fresh source instead.
+        if ( (params == 0) && (first >= TOKEN_PP_INCLUDE) &&
+             (first <= TOKEN_PP_PRAGMA) )
+            break;
+
+        retval = (MacroToken *) Malloc(ctx, sizeof (MacroToken) * count);
+        if (retval == NULL)
+            break;
+    } // for
+
+    *_count = (retval != NULL) ? count : 0;
+    return retval;
+} // tokenize_define
+
+
 static void handle_pp_define(Context *ctx)
 {
     IncludeState *state = ctx->include_stack;
@@ -941,6 +1685,8 @@ static void handle_pp_define(Context *ctx)
     } // if
 
     char *definition = NULL;
+    MacroToken *tokens = NULL;
+    unsigned int tokencount = 0;
     char *sym = (char *) Malloc(ctx, state->tokenlen+1);
     if (sym == NULL)
         return;
@@ -1120,7 +1866,11 @@ static void handle_pp_define(Context *ctx)
 
     assert(done);
 
-    if (!add_define(ctx, sym, definition, idents, params))
+    tokens = tokenize_define(ctx, definition, idents, params, &tokencount);
+    if (ctx->out_of_memory)
+        goto handle_pp_define_failed;
+
+    if (!add_define(ctx, sym, definition, idents, params, tokens, tokencount))
         goto handle_pp_define_failed;
 
     return;
@@ -1128,6 +1878,7 @@ static void handle_pp_define(Context *ctx)
 handle_pp_define_failed:
     Free(ctx, sym);
     Free(ctx, definition);
+    Free(ctx, tokens);
     if (idents != NULL)
     {
         while (params--)
@@ -1192,65 +1943,273 @@ static Conditional *_handle_pp_ifdef(Context *ctx, const Token type)
         return NULL;
     } // if
 
-    char *sym = (char *) alloca(state->tokenlen+1);
-    memcpy(sym, state->token, state->tokenlen);
-    sym[state->tokenlen] = '\0';
+    const char *symtoken = state->token;
+    const unsigned int symlen = state->tokenlen;
+    char *sym = (char *) alloca(symlen+1);
+    memcpy(sym, symtoken, symlen);
+    sym[symlen] = '\0';
+
+    if (!require_newline(state))
+    {
+        if (type == TOKEN_PP_IFDEF)
+            fail(ctx, "Invalid #ifdef directive");
+        else
+            fail(ctx, "Invalid #ifndef directive");
+        return NULL;
+    } // if
+
+    Conditional *conditional = get_conditional(ctx);
+    assert((conditional != NULL) || (ctx->out_of_memory));
+    if (conditional == NULL)
+        return NULL;
+
+    Conditional *parent = state->conditional_stack;
+    const int found = (find_define(ctx, sym) != NULL);
+    const int chosen = (type == TOKEN_PP_IFDEF) ? found : !found;
+    const int skipping = ( (((parent) && (parent->skipping))) || (!chosen) );
+
+    conditional->type = type;
+    conditional->linenum = state->line - 1;
+    conditional->skipping = skipping;
+    conditional->chosen = chosen;
+    conditional->next = parent;
+    state->conditional_stack = conditional;
+
+    if ((type == TOKEN_PP_IFNDEF) && (state->guard_state == INCLUDE_GUARD_START))
+    {
+        state->guard_state = INCLUDE_GUARD_INSIDE;
+        state->guard_macro = symtoken;
+        state->guard_macrolen = symlen;
+        state->guard_conditional = conditional;
+    } // if
+
+    return conditional;
+} // _handle_pp_ifdef
+
+
+static inline void handle_pp_ifdef(Context *ctx)
+{
+    _handle_pp_ifdef(ctx, TOKEN_PP_IFDEF);
+} // handle_pp_ifdef
+
+
+static inline void handle_pp_ifndef(Context *ctx)
+{
+    _handle_pp_ifdef(ctx, TOKEN_PP_IFNDEF);
+} // handle_pp_ifndef
+
+
+// Tokens that lex the same wherever they land in an expansion.
+static inline int replayable_token(const Token token)
+{
+    switch (token)
+    {
+        case ((Token) '\n'):
+        case TOKEN_HASH:
+        case TOKEN_HASHHASH:
+        case TOKEN_SINGLE_COMMENT:
+        case TOKEN_MULTI_COMMENT:
+        case TOKEN_INCOMPLETE_COMMENT:
+        case TOKEN_BAD_CHARS:
+            return 0;
+        default:
+            break;
+    } // switch
+
+    return ((token < TOKEN_PP_INCLUDE) || (token > TOKEN_PP_PRAGMA));
+} // replayable_token
+
+
+static int append_macro_token(MacroToken *tokens, unsigned int *count,
+                              const Token tokenval, const char *token,
+                              const unsigned int tokenlen)
+{
+    static const char spaces[] = "                ";
+    MacroToken *tok = &tokens[*count];
+
+    if (tokenval == ((Token) ' '))
+    {
+        // the lexer would see a run of whitespace as a single token.
+        unsigned int len = tokenlen;
+        if ((*count > 0) && (tok[-1].tokenval == ((Token) ' ')))
+        {
+            tok--;
+            len += tok->tokenlen;
+        } // if
+        else
+        {
+            (*count)++;
+        } // else
+
+        if (len >= sizeof (spaces))
+            return 0;
+
+        tok->tokenval = tokenval;
+        tok->token = spaces;  // it's always spaces by now.
+        tok->tokenlen = len;
+        tok->param = -1;
+        return 1;
+    } // if
+
+    tok->tokenval = tokenval;
+    tok->token = token;
+    tok->tokenlen = tokenlen;
+    tok->param = -1;
+    (*count)++;
+    return 1;
+} // append_macro_token
+
+
+// Most expansions are just the #define's tokens with the arguments dropped
+//  in, so build those as tokens the lexer never has to see again. This has
+//  to come out exactly like lexing the text that replace_and_push_macro()
+//  would build, so anything that might not (stringification, concatenation,
+//  comments or newlines in an argument...) returns -1 to take that path.
+static int push_replaced_macro(Context *ctx, const Define *def,
+                               const MacroArg *args)
+{
+    const int argcount = (def->paramcount < 0) ? 0 : def->paramcount;
+    size_t *arglen = (size_t *) alloca(sizeof (size_t) * (argcount + 1));
+    char **argtext = (char **) alloca(sizeof (char *) * (argcount + 1));
+    size_t maxtokens = 0;
+    size_t textlen = 0;
+    unsigned int count = 0;
+    unsigned int i;
+    int j;
+
+    for (j = 0; j < argcount; j++)
+        argtext[j] = NULL;
+
+    // every byte of an argument might be a token, plus a space before
+    //  each piece of the expansion.
+    for (i = 0; i < def->tokencount; i++)
+    {
+        const MacroToken *tok = &def->tokens[i];
+        if (tok->tokenval == ((Token) ' '))
+            continue;  // replace_and_push_macro() doesn't see these either.
+        else if (!replayable_token(tok->tokenval))
+            return -1;
+        else if (tok->param < 0)
+            maxtokens += 2;
+        else
+        {
+            const int param = tok->param;
+            if (argtext[param] == NULL)
+            {
+                argtext[param] = (char *) args[param].definition;
+                arglen[param] = args[param].deflen;
+                textlen += arglen[param] + 1;
+
+                // a stray quote can open a literal that runs on into the
+                //  rest of the expansion, so only the whole text lexes right.
+                if ( (memchr(argtext[param], '"', arglen[param]) != NULL) ||
+                     (memchr(argtext[param], '\'', arglen[param]) != NULL) )
+                    return -1;
+            } // if
+            maxtokens += arglen[param] + 1;
+        } // else
+    } // for
+
+    const size_t tokbytes = sizeof (MacroToken) * maxtokens;
+    char *block = (char *) Malloc(ctx, tokbytes + textlen);
+    if (block == NULL)
+        return 0;
 
-    if (!require_newline(state))
+    MacroToken *tokens = (MacroToken *) block;
+    char *text = block + tokbytes;
+    for (j = 0; j < argcount; j++)
     {
-        if (type == TOKEN_PP_IFDEF)
-            fail(ctx, "Invalid #ifdef directive");
-        else
-            fail(ctx, "Invalid #ifndef directive");
-        return NULL;
-    } // if
+        if (argtext[j] != NULL)
+        {
+            memcpy(text, argtext[j], arglen[j] + 1);
+            argtext[j] = text;
+            text += arglen[j] + 1;
+        } // if
+    } // for
 
-    Conditional *conditional = get_conditional(ctx);
-    assert((conditional != NULL) || (ctx->out_of_memory));
-    if (conditional == NULL)
-        return NULL;
+    for (i = 0; i < def->tokencount; i++)
+    {
+        const MacroToken *tok = &def->tokens[i];
+        if (tok->tokenval == ((Token) ' '))
+            continue;
 
-    Conditional *parent = state->conditional_stack;
-    const int found = (find_define(ctx, sym) != NULL);
-    const int chosen = (type == TOKEN_PP_IFDEF) ? found : !found;
-    const int skipping = ( (((parent) && (parent->skipping))) || (!chosen) );
+        if (count > 0)  // put a space between tokens.
+        {
+            if (!append_macro_token(tokens, &count, (Token) ' ', NULL, 1))
+                goto push_replaced_macro_text;
+        } // if
 
-    conditional->type = type;
-    conditional->linenum = state->line - 1;
-    conditional->skipping = skipping;
-    conditional->chosen = chosen;
-    conditional->next = parent;
-    state->conditional_stack = conditional;
-    return conditional;
-} // _handle_pp_ifdef
+        if (tok->param < 0)
+        {
+            append_macro_token(tokens, &count, tok->tokenval, tok->token,
+                               tok->tokenlen);
+            continue;
+        } // if
 
+        IncludeState argstate;
+        memset(&argstate, '\0', sizeof (IncludeState));
+        argstate.source_base = argtext[tok->param];
+        argstate.source = argstate.source_base;
+        argstate.token = argstate.source_base;
+        argstate.tokenval = TOKEN_UNKNOWN;  // not the start of a line.
+        argstate.orig_length = (unsigned int) arglen[tok->param];
+        argstate.bytes_left = argstate.orig_length;
+        argstate.report_whitespace = 1;
+        argstate.report_comments = 1;
+        argstate.asm_comments = ctx->asm_comments;
+
+        while (preprocessor_lexer(&argstate) != TOKEN_EOI)
+        {
+            if (!replayable_token(argstate.tokenval))
+                goto push_replaced_macro_text;
+            else if (!append_macro_token(tokens, &count, argstate.tokenval,
+                                         argstate.token, argstate.tokenlen))
+                goto push_replaced_macro_text;
+        } // while
 
-static inline void handle_pp_ifdef(Context *ctx)
-{
-    _handle_pp_ifdef(ctx, TOKEN_PP_IFDEF);
-} // handle_pp_ifdef
+        if (argstate.line != 0)  // swallowed a line continuation.
+            goto push_replaced_macro_text;
+    } // for
 
+    assert(count <= maxtokens);
 
-static inline void handle_pp_ifndef(Context *ctx)
-{
-    _handle_pp_ifdef(ctx, TOKEN_PP_IFNDEF);
-} // handle_pp_ifndef
+    const unsigned int srclen = (unsigned int) (text - block);
+    if (!push_macro_tokens(ctx, block, srclen, tokens, count,
+                           close_define_include))
+    {
+        Free(ctx, block);
+        return 0;
+    } // if
+
+    return 1;
+
+push_replaced_macro_text:
+    Free(ctx, block);
+    return -1;
+} // push_replaced_macro
 
 
 static int replace_and_push_macro(Context *ctx, const Define *def,
-                                  const Define *params)
+                                  const MacroArg *args)
 {
     char *final = NULL;
+    IncludeState *state = ctx->include_stack;
 
-    // We push the #define and lex it, building a buffer with argument
+    if (def->tokens == NULL)  // empty replacement list, nothing to replace.
+        return push_source(ctx, state->filename, def->definition, 0,
+                           state->line, NULL);
+
+    const int rc = push_replaced_macro(ctx, def, args);
+    if (rc >= 0)
+        return rc;
+
+    // We replay the #define's tokens, building a buffer with argument
     //  replacement, stringification, and concatenation.
     Buffer *buffer = buffer_create(128, MallocBridge, FreeBridge, ctx);
     if (buffer == NULL)
         return 0;
 
-    IncludeState *state = ctx->include_stack;
-    if (!push_source(ctx, state->filename, def->definition,
-                     strlen(def->definition), state->line, NULL))
+    if (!push_macro_source(ctx, def))
     {
         buffer_destroy(buffer);
         return 0;
@@ -1260,7 +2219,7 @@ static int replace_and_push_macro(Context *ctx, const Define *def,
     while (lexer(state) != TOKEN_EOI)
     {
         int wantorig = 0;
-        const Define *arg = NULL;
+        const MacroArg *arg = NULL;
 
         // put a space between tokens if we're not concatenating.
         if (state->tokenval == TOKEN_HASHHASH)  // concatenate?
@@ -1291,11 +2250,11 @@ static int replace_and_push_macro(Context *ctx, const Define *def,
 
             if (state->tokenval == TOKEN_IDENTIFIER)
             {
-                arg = find_macro_arg(state, params);
+                arg = find_macro_arg(state, args);
                 if (arg != NULL)
                 {
                     data = arg->original;
-                    len = strlen(data);
+                    len = arg->origlen;
                 } // if
             } // if
 
@@ -1310,7 +2269,7 @@ static int replace_and_push_macro(Context *ctx, const Define *def,
 
         if (state->tokenval == TOKEN_IDENTIFIER)
         {
-            arg = find_macro_arg(state, params);
+            arg = find_macro_arg(state, args);
             if (arg != NULL)
             {
                 if (!wantorig)
@@ -1319,7 +2278,7 @@ static int replace_and_push_macro(Context *ctx, const Define *def,
                     pushback(state);
                 } // if
                 data = wantorig ? arg->original : arg->definition;
-                len = strlen(data);
+                len = wantorig ? arg->origlen : arg->deflen;
             } // if
         } // if
 
@@ -1354,9 +2313,12 @@ static int handle_macro_args(Context *ctx, const char *sym, const Define *def)
 {
     int retval = 0;
     IncludeState *state = ctx->include_stack;
-    Define *params = NULL;
+    ScratchText *text = &ctx->argtext;
+    ScratchText *origtext = &ctx->argorigtext;
     const int expected = (def->paramcount < 0) ? 0 : def->paramcount;
+    MacroArg *args = (MacroArg *) alloca(sizeof (MacroArg) * (expected + 1));
     int saw_params = 0;
+    int i;
     IncludeState saved;  // can't pushback, we need the original token.
     memcpy(&saved, state, sizeof (IncludeState));
     if (lexer(state) != ((Token) '('))
@@ -1367,12 +2329,16 @@ static int handle_macro_args(Context *ctx, const char *sym, const Define *def)
 
     state->report_whitespace = 1;
 
+    // all the arguments go end to end in the scratch text, null-terminated.
+    text->len = 0;
+    origtext->len = 0;
+
     int void_call = 0;
     int paren = 1;
     while (paren > 0)
     {
-        Buffer *buffer = buffer_create(128, MallocBridge, FreeBridge, ctx);
-        Buffer *origbuffer = buffer_create(128, MallocBridge, FreeBridge, ctx);
+        const size_t start = text->len;
+        const size_t origstart = origtext->len;
 
         Token t = lexer(state);
 
@@ -1406,8 +2372,8 @@ static int handle_macro_args(Context *ctx, const char *sym, const Define *def)
                 // don't add whitespace to the start, so we recognize
                 //  void calls correctly.
                 origexpr = expr = " ";
-                origexprlen = (buffer_size(origbuffer) == 0) ? 0 : 1;
-                exprlen = (buffer_size(buffer) == 0) ? 0 : 1;
+                origexprlen = (origtext->len == origstart) ? 0 : 1;
+                exprlen = (text->len == start) ? 0 : 1;
             } // else if
 
             else if (t == TOKEN_IDENTIFIER)
@@ -1430,62 +2396,39 @@ static int handle_macro_args(Context *ctx, const char *sym, const Define *def)
 
             assert(expr != NULL);
 
-            if (!buffer_append(buffer, expr, exprlen))
+            if (!scratch_append(ctx, text, expr, exprlen))
                 goto handle_macro_args_failed;
 
-            if (!buffer_append(origbuffer, origexpr, origexprlen))
+            if (!scratch_append(ctx, origtext, origexpr, origexprlen))
                 goto handle_macro_args_failed;
 
             t = lexer(state);
         } // while
 
-        if (buffer_size(buffer) == 0)
+        if (text->len == start)
             void_call = ((saw_params == 0) && (paren == 0));
 
-        if (saw_params < expected)
+        if (saw_params >= expected)  // too many, we'll fail below.
         {
-            const int origdeflen = (int) buffer_size(origbuffer);
-            char *origdefinition = buffer_flatten(origbuffer);
-            const int deflen = (int) buffer_size(buffer);
-            char *definition = buffer_flatten(buffer);
-            Define *p = get_define(ctx);
-            if ((!origdefinition) || (!definition) || (!p))
-            {
-                Free(ctx, origdefinition);
-                Free(ctx, definition);
-                buffer_destroy(origbuffer);
-                buffer_destroy(buffer);
-                free_define(ctx, p);
-                goto handle_macro_args_failed;
-            } // if
-
-            // trim any whitespace from the end of the string...
-            int i;
-            for (i = deflen - 1; i >= 0; i--)
-            {
-                if (definition[i] == ' ')
-                    definition[i] = '\0';
-                else
-                    break;
-            } // for
-
-            for (i = origdeflen - 1; i >= 0; i--)
-            {
-                if (origdefinition[i] == ' ')
-                    origdefinition[i] = '\0';
-                else
-                    break;
-            } // for
-
-            p->identifier = def->parameters[saw_params];
-            p->definition = definition;
-            p->original = origdefinition;
-            p->next = params;
-            params = p;
+            text->len = start;
+            origtext->len = origstart;
         } // if
+        else
+        {
+            // trim any whitespace from the end of the string...
+            while ((text->len > start) && (text->data[text->len-1] == ' '))
+                text->len--;
+            while ( (origtext->len > origstart) &&
+                    (origtext->data[origtext->len-1] == ' ') )
+                origtext->len--;
+
+            args[saw_params].deflen = (unsigned int) (text->len - start);
+            args[saw_params].origlen = (unsigned int) (origtext->len - origstart);
+            if ( (!scratch_append(ctx, text, "", 1)) ||
+                 (!scratch_append(ctx, origtext, "", 1)) )
+                goto handle_macro_args_failed;
+        } // else
 
-        buffer_destroy(buffer);
-        buffer_destroy(origbuffer);
         saw_params++;
     } // while
 
@@ -1493,10 +2436,7 @@ static int handle_macro_args(Context *ctx, const char *sym, const Define *def)
 
     // "a()" should match "#define a()" ...
     if ((expected == 0) && (saw_params == 1) && (void_call))
-    {
-        assert(params == NULL);
         saw_params = 0;
-    } // if
 
     if (saw_params != expected)
     {
@@ -1505,18 +2445,21 @@ static int handle_macro_args(Context *ctx, const char *sym, const Define *def)
         goto handle_macro_args_failed;
     } // if
 
+    // the scratch text is done moving around, point the args into it.
+    const char *definition = text->data;
+    const char *original = origtext->data;
+    for (i = 0; i < expected; i++)
+    {
+        args[i].definition = definition;
+        args[i].original = original;
+        definition += args[i].deflen + 1;
+        original += args[i].origlen + 1;
+    } // for
+
     // this handles arg replacement and the '##' and '#' operators.
-    retval = replace_and_push_macro(ctx, def, params);
+    retval = replace_and_push_macro(ctx, def, args);
 
 handle_macro_args_failed:
-    while (params)
-    {
-        Define *next = params->next;
-        params->identifier = NULL;
-        free_define(ctx, params);
-        params = next;
-    } // while
-
     state->report_whitespace = 0;
     return retval;
 } // handle_macro_args
@@ -1533,16 +2476,16 @@ static int handle_pp_identifier(Context *ctx)
     IncludeState *state = ctx->include_stack;
     const char *fname = state->filename;
     const unsigned int line = state->line;
-    char *sym = (char *) alloca(state->tokenlen+1);
-    memcpy(sym, state->token, state->tokenlen);
-    sym[state->tokenlen] = '\0';
 
     // Is this identifier #defined?
-    const Define *def = find_define(ctx, sym);
+    const Define *def = find_define_by_token(ctx);
     if (def == NULL)
         return 0;   // just send the token through unchanged.
     else if (def->paramcount != 0)
-        return handle_macro_args(ctx, sym, def);
+        return handle_macro_args(ctx, def->identifier, def);
+
+    else if (def->tokens != NULL)
+        return push_macro_source(ctx, def);
 
     const size_t deflen = strlen(def->definition);
     return push_source(ctx, fname, def->definition, deflen, line, NULL);
@@ -1970,6 +2913,42 @@ static void handle_pp_endif(Context *ctx)
 } // handle_pp_endif
 
 
+// "#pragma once" means we can skip this file next time. Like every other
+//  #pragma, it still goes through to the caller.
+static void check_pp_pragma_once(Context *ctx)
+{
+    IncludeState *state = ctx->include_stack;
+    const char *ptr = state->source;
+    unsigned int avail = state->bytes_left;
+
+    if (state->guard_key == NULL)
+        return;  // we wouldn't know this file when we see it again.
+
+    // peek at the raw source, so the pragma comes through untouched.
+    while ((avail > 0) && ((*ptr == ' ') || (*ptr == '\t')))
+    {
+        ptr++;
+        avail--;
+    } // while
+
+    if ((avail < 4) || (memcmp(ptr, "once", 4) != 0))
+        return;
+
+    ptr += 4;
+    avail -= 4;
+    while ((avail > 0) && ((*ptr == ' ') || (*ptr == '\t')))
+    {
+        ptr++;
+        avail--;
+    } // while
+
+    // "#pragma onceler" or "#pragma once more" aren't ours.
+    if ((avail == 0) || (*ptr == '\r') || (*ptr == '\n') ||
+        ((avail >= 2) && (ptr[0] == '/') && ((ptr[1] == '/') || (ptr[1] == '*'))))
+        remember_include_guard(ctx, state->guard_key, NULL);
+} // check_pp_pragma_once
+
+
 static void unterminated_pp_condition(Context *ctx)
 {
     IncludeState *state = ctx->include_stack;
@@ -2034,6 +3013,9 @@ static inline const char *_preprocessor_nexttoken(Preprocessor *_ctx,
         if (token != TOKEN_IDENTIFIER)
             ctx->recursion_count = 0;
 
+        if ((state->guard_state != INCLUDE_GUARD_NONE) && (token != ((Token) '\n')))
+            track_include_guard(ctx, state, token);
+
         if (token == TOKEN_EOI)
         {
             assert(state->bytes_left == 0);
@@ -2132,6 +3114,7 @@ static inline const char *_preprocessor_nexttoken(Preprocessor *_ctx,
 
         else if (token == TOKEN_PP_PRAGMA)
         {
+            check_pp_pragma_once(ctx);
             ctx->parsing_pragma = 1;
         } // else if
 
@@ -2227,14 +3210,14 @@ static const MOJOSHADER_preprocessData out_of_mem_data_preprocessor = {
 };
 
 
-// public API...
-
-const MOJOSHADER_preprocessData *MOJOSHADER_preprocess(const char *filename,
+static const MOJOSHADER_preprocessData *preprocess(const char *filename,
                              const char *source, unsigned int sourcelen,
                              const MOJOSHADER_preprocessorDefine *defines,
                              unsigned int define_count,
                              MOJOSHADER_includeOpen include_open,
                              MOJOSHADER_includeClose include_close,
+                             MOJOSHADER_includeCache *include_cache,
+                             PermutationBatch *batch,
                              MOJOSHADER_malloc m, MOJOSHADER_free f, void *d)
 {
     MOJOSHADER_preprocessData *retval = NULL;
@@ -2268,11 +3251,13 @@ const MOJOSHADER_preprocessData *MOJOSHADER_preprocess(const char *filename,
     if (!include_close) include_close = MOJOSHADER_internal_include_close;
 
     pp = preprocessor_start(filename, source, sourcelen,
-                            include_open, include_close,
+                            include_open, include_close, include_cache,
                             defines, define_count, 0, m, f, d);
     if (pp == NULL)
         goto preprocess_out_of_mem;
 
+    ((Context *) pp)->batch = batch;
+
     errors = errorlist_create(MallocBridge, FreeBridge, pp);
     if (errors == NULL)
         goto preprocess_out_of_mem;
@@ -2435,9 +3420,399 @@ preprocess_out_of_mem:
     f(linebuf, d);
 #endif
     return &out_of_mem_data_preprocessor;
+} // preprocess
+
+
+// Permutations...
+
+// A permutation's defines can share output with another permutation if
+//  they're simple enough that "#define X Y" can't fail, or spill onto the
+//  following lines.
+static int simple_permutation(const MOJOSHADER_preprocessPermutation *perm)
+{
+    unsigned int i;
+    for (i = 0; i < perm->define_count; i++)
+    {
+        const char *ident = perm->defines[i].identifier;
+        const char *def = perm->defines[i].definition;
+        const char *ptr;
+
+        if ((ident == NULL) || (def == NULL))
+            return 0;
+        else if ((*ident == '\0') || ((*ident >= '0') && (*ident <= '9')))
+            return 0;
+        else if (strcmp(ident, "defined") == 0)
+            return 0;
+        else if ((strcmp(ident, "__FILE__") == 0) || (strcmp(ident, "__LINE__") == 0))
+            return 0;  // can't redefine these.
+
+        for (ptr = ident; *ptr; ptr++)
+        {
+            const char ch = *ptr;
+            if ( !(((ch >= 'a') && (ch <= 'z')) || ((ch >= 'A') && (ch <= 'Z')) ||
+                   ((ch >= '0') && (ch <= '9')) || (ch == '_')) )
+                return 0;  // function-like macro, whitespace, whatever.
+        } // for
+
+        for (ptr = def; *ptr; ptr++)
+        {
+            switch (*ptr)
+            {
+                case '\r': case '\n': case '\\':
+                case '\"': case '\'': case '#':
+                    return 0;
+                case '/':
+                    if (ptr[1] == '*')
+                        return 0;
+                    break;
+                default: break;
+            } // switch
+        } // for
+    } // for
+
+    return 1;
+} // simple_permutation
+
+// What a finished permutation looked at, and what it saw.
+typedef struct PermutationRun
+{
+    int output;
+    unsigned int query_count;
+    unsigned int *queries;  // indices into the batch's names.
+    const char **values;  // definition of each, NULL if it wasn't #defined.
+} PermutationRun;
+
+static int same_definition(const char *a, const char *b)
+{
+    if ((a == NULL) || (b == NULL))
+        return (a == b);
+    return (strcmp(a, b) == 0);
+} // same_definition
+
+static void nuke_permutation_include(const void *ctx, const void *key,
+                                     const void *value, void *data)
+{
+    PermutationBatch *batch = (PermutationBatch *) data;
+    PermutationInclude *incl = (PermutationInclude *) value;
+    incl->close_callback(incl->data, batch->m, batch->f, batch->d);
+    batch->f(incl, batch->d);
+} // nuke_permutation_include
+
+static void nuke_permutation_name(const void *ctx, const void *key,
+                                  const void *value, void *data)
+{
+    // no-op, the keys live in batch->name_keys.
+} // nuke_permutation_name
+
+static void free_permutation_batch(PermutationBatch *batch)
+{
+    if (batch != NULL)
+    {
+        MOJOSHADER_free f = batch->f;
+        void *d = batch->d;
+        if (batch->includes != NULL)
+            hash_destroy(batch->includes, NULL);
+        if (batch->names != NULL)
+            hash_destroy(batch->names, NULL);
+        f(batch->name_keys, d);
+        f(batch->queried, d);
+        f(batch->query_list, d);
+        f(batch, d);
+    } // if
+} // free_permutation_batch
+
+static PermutationBatch *create_permutation_batch(
+                        const MOJOSHADER_preprocessPermutation *perms,
+                        const unsigned int perm_count, const int *simple,
+                        MOJOSHADER_malloc m, MOJOSHADER_free f, void *d)
+{
+    PermutationBatch *batch = NULL;
+    unsigned int total = 0;
+    unsigned int i, j;
+
+    for (i = 0; i < perm_count; i++)
+    {
+        if (simple[i])
+            total += perms[i].define_count;
+    } // for
+
+    batch = (PermutationBatch *) m(sizeof (PermutationBatch), d);
+    if (batch == NULL)
+        return NULL;
+    memset(batch, '\0', sizeof (PermutationBatch));
+    batch->m = m;
+    batch->f = f;
+    batch->d = d;
+
+    batch->includes = hash_create(batch, hash_hash_string, hash_keymatch_string,
+                                  nuke_permutation_include, 0, m, f, d);
+    batch->names = hash_create(NULL, hash_define, keymatch_define,
+                               nuke_permutation_name, 0, m, f, d);
+    batch->name_keys = (Define *) m(sizeof (Define) * (total + 1), d);
+    if ((!batch->includes) || (!batch->names) || (!batch->name_keys))
+    {
+        free_permutation_batch(batch);
+        return NULL;
+    } // if
+
+    // give every name any simple permutation defines a slot.
+    for (i = 0; i < perm_count; i++)
+    {
+        for (j = 0; (simple[i]) && (j < perms[i].define_count); j++)
+        {
+            Define *key = &batch->name_keys[batch->name_count];
+            memset(key, '\0', sizeof (Define));
+            const char *ident = perms[i].defines[j].identifier;
+            init_define_key(key, ident, (unsigned int) strlen(ident));
+            if (hash_find(batch->names, key, NULL))
+                continue;
+            const void *idx = (const void *) (size_t) batch->name_count;
+            if (hash_insert(batch->names, key, idx) != 1)
+            {
+                free_permutation_batch(batch);
+                return NULL;
+            } // if
+            batch->name_filter |= ((uint64) 1) << (key->identifier_hash & 63);
+            batch->name_count++;
+        } // for
+    } // for
+
+    const unsigned int count = batch->name_count + 1;
+    batch->queried = (unsigned char *) m(count, d);
+    batch->query_list = (unsigned int *) m(sizeof (unsigned int) * count, d);
+    if ((!batch->queried) || (!batch->query_list))
+    {
+        free_permutation_batch(batch);
+        return NULL;
+    } // if
+    memset(batch->queried, '\0', count);
+
+    return batch;
+} // create_permutation_batch
+
+// Fill in (values) with permutation (perm)'s definition for every name in
+//  the batch. Returns zero if it defines something twice, which is an error
+//  we can't share.
+static int permutation_values(const PermutationBatch *batch,
+                              const MOJOSHADER_preprocessPermutation *perm,
+                              const char **values)
+{
+    unsigned int i;
+    memset(values, '\0', sizeof (const char *) * batch->name_count);
+    for (i = 0; i < perm->define_count; i++)
+    {
+        const void *value = NULL;
+        Define key;
+        const char *ident = perm->defines[i].identifier;
+        init_define_key(&key, ident, (unsigned int) strlen(ident));
+        if (!hash_find(batch->names, &key, &value))
+            return 0;  // shouldn't happen.
+
+        const unsigned int idx = (unsigned int) (size_t) value;
+        if (values[idx] != NULL)
+            return 0;
+        values[idx] = perm->defines[i].definition;
+    } // for
+    return 1;
+} // permutation_values
+
+static const PermutationRun *find_permutation_run(const PermutationRun *runs,
+                                                  const unsigned int run_count,
+                                                  const char **values)
+{
+    unsigned int i, j;
+    for (i = 0; i < run_count; i++)
+    {
+        const PermutationRun *run = &runs[i];
+        for (j = 0; j < run->query_count; j++)
+        {
+            const char *val = values[run->queries[j]];
+            if (!same_definition(run->values[j], val))
+                break;
+        } // for
+
+        if (j == run->query_count)
+            return run;  // agrees on everything that run looked at.
+    } // for
+
+    return NULL;
+} // find_permutation_run
+
+static int record_permutation_run(PermutationBatch *batch,
+                                  PermutationRun *run, const int output,
+                                  const char **values)
+{
+    const unsigned int count = batch->query_count;
+    unsigned int i;
+
+    run->output = output;
+    run->query_count = count;
+    run->queries = (unsigned int *) batch->m(sizeof (unsigned int) * count, batch->d);
+    run->values = (const char **) batch->m(sizeof (const char *) * count, batch->d);
+    if ((run->queries == NULL) || (run->values == NULL))
+    {
+        batch->f(run->queries, batch->d);
+        batch->f(run->values, batch->d);
+        return 0;
+    } // if
+
+    for (i = 0; i < count; i++)
+    {
+        run->queries[i] = batch->query_list[i];
+        run->values[i] = values[batch->query_list[i]];
+    } // for
+
+    return 1;
+} // record_permutation_run
+
+
+// public API...
+
+const MOJOSHADER_preprocessData *MOJOSHADER_preprocess(const char *filename,
+                             const char *source, unsigned int sourcelen,
+                             const MOJOSHADER_preprocessorDefine *defines,
+                             unsigned int define_count,
+                             MOJOSHADER_includeOpen include_open,
+                             MOJOSHADER_includeClose include_close,
+                             MOJOSHADER_includeCache *include_cache,
+                             MOJOSHADER_malloc m, MOJOSHADER_free f, void *d)
+{
+    return preprocess(filename, source, sourcelen, defines, define_count,
+                      include_open, include_close, include_cache, NULL,
+                      m, f, d);
 } // MOJOSHADER_preprocess
 
 
+const MOJOSHADER_preprocessPermutationData *MOJOSHADER_preprocessPermutations(
+                             const char *filename,
+                             const char *source, unsigned int sourcelen,
+                             const MOJOSHADER_preprocessPermutation *perms,
+                             unsigned int perm_count,
+                             MOJOSHADER_includeOpen include_open,
+                             MOJOSHADER_includeClose include_close,
+                             MOJOSHADER_includeCache *include_cache,
+                             MOJOSHADER_malloc m, MOJOSHADER_free f, void *d)
+{
+    MOJOSHADER_preprocessPermutationData *retval = NULL;
+    PermutationBatch *batch = NULL;
+    PermutationRun *runs = NULL;
+    unsigned int run_count = 0;
+    const char **values = NULL;
+    int *simple = NULL;
+    unsigned int i;
+
+    if (!m) m = MOJOSHADER_internal_malloc;
+    if (!f) f = MOJOSHADER_internal_free;
+    if (!include_open) include_open = MOJOSHADER_internal_include_open;
+    if (!include_close) include_close = MOJOSHADER_internal_include_close;
+
+    retval = (MOJOSHADER_preprocessPermutationData *) m(sizeof (*retval), d);
+    if (retval == NULL)
+        return NULL;
+    memset(retval, '\0', sizeof (*retval));
+    retval->malloc = m;
+    retval->free = f;
+    retval->malloc_data = d;
+
+    const size_t outlen = sizeof (MOJOSHADER_preprocessData *) * perm_count;
+    retval->output_index = (int *) m(sizeof (int) * perm_count, d);
+    retval->outputs = (const MOJOSHADER_preprocessData **) m(outlen, d);
+    simple = (int *) m(sizeof (int) * perm_count, d);
+    runs = (PermutationRun *) m(sizeof (PermutationRun) * perm_count, d);
+    if ((!retval->output_index) || (!retval->outputs) || (!simple) || (!runs))
+        goto preprocess_permutations_failed;
+
+    for (i = 0; i < perm_count; i++)
+        simple[i] = simple_permutation(&perms[i]);
+
+    batch = create_permutation_batch(perms, perm_count, simple, m, f, d);
+    if (batch == NULL)
+        goto preprocess_permutations_failed;
+
+    values = (const char **) m(sizeof (char *) * (batch->name_count + 1), d);
+    if (values == NULL)
+        goto preprocess_permutations_failed;
+
+    for (i = 0; i < perm_count; i++)
+    {
+        const MOJOSHADER_preprocessPermutation *perm = &perms[i];
+        const int shareable = simple[i] && permutation_values(batch, perm, values);
+
+        if (shareable)
+        {
+            const PermutationRun *run = find_permutation_run(runs, run_count, values);
+            if (run != NULL)
+            {
+                retval->output_index[i] = run->output;
+                continue;  // nothing it looks at is different, reuse it.
+            } // if
+        } // if
+
+        const int output = retval->output_count;
+        const MOJOSHADER_preprocessData *pd;
+        batch->recording = shareable;
+        batch->query_count = 0;
+        pd = preprocess(filename, source, sourcelen, perm->defines,
+                        perm->define_count, include_open, include_close,
+                        include_cache, batch, m, f, d);
+        batch->recording = 0;
+
+        retval->outputs[retval->output_count++] = pd;
+        retval->output_index[i] = output;
+
+        if ((shareable) && (pd != &out_of_mem_data_preprocessor))
+        {
+            // if this fails, we just can't share this one's output.
+            if (record_permutation_run(batch, &runs[run_count], output, values))
+                run_count++;
+        } // if
+
+        while (batch->query_count > 0)
+            batch->queried[batch->query_list[--batch->query_count]] = 0;
+    } // for
+
+    retval->permutation_count = (int) perm_count;
+
+    for (i = 0; i < run_count; i++)
+    {
+        f(runs[i].queries, d);
+        f((void *) runs[i].values, d);
+    } // for
+    f(runs, d);
+    f(simple, d);
+    f((void *) values, d);
+    free_permutation_batch(batch);
+    return retval;
+
+preprocess_permutations_failed:
+    f(runs, d);
+    f(simple, d);
+    f((void *) values, d);
+    free_permutation_batch(batch);
+    MOJOSHADER_freePreprocessPermutationData(retval);
+    return NULL;
+} // MOJOSHADER_preprocessPermutations
+
+
+void MOJOSHADER_freePreprocessPermutationData(const MOJOSHADER_preprocessPermutationData *_data)
+{
+    MOJOSHADER_preprocessPermutationData *data;
+    data = (MOJOSHADER_preprocessPermutationData *) _data;
+    if (data == NULL)
+        return;
+
+    MOJOSHADER_free f = data->free;
+    void *d = data->malloc_data;
+    int i;
+
+    for (i = 0; i < data->output_count; i++)
+        MOJOSHADER_freePreprocessData(data->outputs[i]);
+    f((void *) data->outputs, d);
+    f(data->output_index, d);
+    f(data, d);
+} // MOJOSHADER_freePreprocessPermutationData
+
+
 void MOJOSHADER_freePreprocessData(const MOJOSHADER_preprocessData *_data)
 {
     MOJOSHADER_preprocessData *data = (MOJOSHADER_preprocessData *) _data;
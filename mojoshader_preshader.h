@@ -0,0 +1,231 @@
+/**
+ * MojoShader; generate shader programs from bytecode of compiled
+ *  Direct3D shaders.
+ *
+ * Please see the file LICENSE.txt in the source's root directory.
+ *
+ *  This file written by Ryan C. Gordon.
+ */
+
+#ifndef _INCL_MOJOSHADER_PRESHADER_H_
+#define _INCL_MOJOSHADER_PRESHADER_H_
+
+/* The math behind effect preshader programs, one op at a time. This is
+ * internal, and only split out of mojoshader_effects.c so that
+ * utils/testpreshader.c can check the four-wide ops against the scalar
+ * ones without building the rest of the effects code. Include
+ * mojoshader_internal.h first.
+ */
+
+#ifndef MOJOSHADER_USE_SDL_STDLIB
+#include <math.h>
+#endif /* MOJOSHADER_USE_SDL_STDLIB */
+#include <float.h>
+
+/* The four-wide ops round every product before adding it, so the scalar
+ * ones must not fuse them into FMAs. GCC ignores this pragma; the build
+ * passes -ffp-contract=off instead.
+ */
+#if defined(__clang__)
+#pragma STDC FP_CONTRACT OFF
+#elif defined(_MSC_VER)
+#pragma fp_contract (off)
+#endif
+
+#ifdef MOJOSHADER_PRESHADER_DOUBLE
+typedef double preshader_real;
+#else
+typedef float preshader_real;
+#endif
+
+static inline void runpreshaderop(const uint32 opcode, const int elems,
+                                  const preshader_real *src0,
+                                  const preshader_real *src1,
+                                  const preshader_real *src2,
+                                  preshader_real *dst)
+{
+    int i;
+    switch (opcode)
+    {
+        #define OPCODE_CASE(op, val) \
+            case MOJOSHADER_PRESHADEROP_##op: \
+                for (i = 0; i < elems; i++) { dst[i] = (preshader_real) (val); } \
+                break;
+
+        OPCODE_CASE(MOV, src0[i])
+        OPCODE_CASE(NEG, -src0[i])
+        OPCODE_CASE(RCP, 1.0f / src0[i])
+        OPCODE_CASE(FRC, src0[i] - floor(src0[i]))
+        OPCODE_CASE(EXP, exp(src0[i]))
+        OPCODE_CASE(LOG, log(src0[i]))
+        OPCODE_CASE(RSQ, 1.0 / sqrt(src0[i]))
+        OPCODE_CASE(SIN, sin(src0[i]))
+        OPCODE_CASE(COS, cos(src0[i]))
+        OPCODE_CASE(ASIN, asin(src0[i]))
+        OPCODE_CASE(ACOS, acos(src0[i]))
+        OPCODE_CASE(ATAN, atan(src0[i]))
+        OPCODE_CASE(MIN, (src0[i] < src1[i]) ? src0[i] : src1[i])
+        OPCODE_CASE(MAX, (src0[i] > src1[i]) ? src0[i] : src1[i])
+        OPCODE_CASE(LT, (src0[i] < src1[i]) ? 1.0f : 0.0f)
+        OPCODE_CASE(GE, (src0[i] >= src1[i]) ? 1.0f : 0.0f)
+        OPCODE_CASE(ADD, src0[i] + src1[i])
+        OPCODE_CASE(MUL, src0[i] * src1[i])
+        OPCODE_CASE(ATAN2, atan2(src0[i], src1[i]))
+        OPCODE_CASE(DIV, src0[i] / src1[i])
+        OPCODE_CASE(CMP, (src0[i] >= 0.0f) ? src1[i] : src2[i])
+        OPCODE_CASE(MIN_SCALAR, (src0[0] < src1[i]) ? src0[0] : src1[i])
+        OPCODE_CASE(MAX_SCALAR, (src0[0] > src1[i]) ? src0[0] : src1[i])
+        OPCODE_CASE(LT_SCALAR, (src0[0] < src1[i]) ? 1.0f : 0.0f)
+        OPCODE_CASE(GE_SCALAR, (src0[0] >= src1[i]) ? 1.0f : 0.0f)
+        OPCODE_CASE(ADD_SCALAR, src0[0] + src1[i])
+        OPCODE_CASE(MUL_SCALAR, src0[0] * src1[i])
+        OPCODE_CASE(ATAN2_SCALAR, atan2(src0[0], src1[i]))
+        OPCODE_CASE(DIV_SCALAR, src0[0] / src1[i])
+        #undef OPCODE_CASE
+
+        case MOJOSHADER_PRESHADEROP_DOT:
+        {
+            // Each product is rounded before it's added, like
+            //  runpreshaderop4() does; see FP_CONTRACT above.
+            preshader_real final = 0.0f;
+            for (i = 0; i < elems; i++)
+                final += src0[i] * src1[i];
+            for (i = 0; i < elems; i++)
+                dst[i] = final;
+            break;
+        } // case
+
+        default:
+            assert(0 && "compilepreshader let an opcode through!");
+            break;
+    } // switch
+} // runpreshaderop
+
+/* Four-wide preshader ops...
+ * Most preshader math is on float4 registers, so with float math the common
+ * opcodes are done a whole register at a time where the target has a vector
+ * unit we can count on: SSE2 on x86-64, and NEON on AArch64 (32-bit NEON
+ * flushes denormals, so it isn't used). 32-bit x86 only gets SSE2 when its
+ * scalar float math is done in SSE registers too (FLT_EVAL_METHOD == 0);
+ * with x87 math the scalar ops round differently, and the two would
+ * disagree. Every op here has to
+ * give exactly what the scalar switch in runpreshaderop() would, bit
+ * for bit, so MIN/MAX are compare-and-select rather than the native min/max
+ * (which disagree on signed zeros), and DOT adds its products in order.
+ * Define MOJOSHADER_PRESHADER_NO_SIMD to always use the scalar path.
+ */
+
+#if !defined(MOJOSHADER_PRESHADER_DOUBLE) && !defined(MOJOSHADER_PRESHADER_NO_SIMD)
+#if defined(__x86_64__) || defined(_M_X64) || \
+    (defined(__SSE2__) && defined(FLT_EVAL_METHOD) && (FLT_EVAL_METHOD == 0))
+#define PRESHADER_SIMD 1
+#include <emmintrin.h>
+typedef __m128 preshader_vec;
+#define VLOAD(ptr) _mm_loadu_ps(ptr)
+#define VSTORE(ptr, v) _mm_storeu_ps(ptr, v)
+#define VSPLAT(x) _mm_set1_ps(x)
+#define VADD(a, b) _mm_add_ps(a, b)
+#define VMUL(a, b) _mm_mul_ps(a, b)
+#define VDIV(a, b) _mm_div_ps(a, b)
+#define VNEG(a) _mm_xor_ps(a, _mm_set1_ps(-0.0f))
+#define VLT(a, b) _mm_cmplt_ps(a, b)
+#define VGE(a, b) _mm_cmpge_ps(a, b)
+#define VMASK(m, a) _mm_and_ps(m, a)
+#define VSELECT(m, a, b) _mm_or_ps(_mm_and_ps(m, a), _mm_andnot_ps(m, b))
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#define PRESHADER_SIMD 1
+#include <arm_neon.h>
+typedef float32x4_t preshader_vec;
+#define VLOAD(ptr) vld1q_f32(ptr)
+#define VSTORE(ptr, v) vst1q_f32(ptr, v)
+#define VSPLAT(x) vdupq_n_f32(x)
+#define VADD(a, b) vaddq_f32(a, b)
+#define VMUL(a, b) vmulq_f32(a, b)
+#define VDIV(a, b) vdivq_f32(a, b)
+#define VNEG(a) vnegq_f32(a)
+#define VLT(a, b) vcltq_f32(a, b)
+#define VGE(a, b) vcgeq_f32(a, b)
+#define VMASK(m, a) vreinterpretq_f32_u32(vandq_u32(m, vreinterpretq_u32_f32(a)))
+#define VSELECT(m, a, b) vbslq_f32(m, a, b)
+#endif
+#endif
+
+#ifdef PRESHADER_SIMD
+// Returns zero if (opcode) isn't one we do four-wide.
+static inline int runpreshaderop4(const uint32 opcode,
+                                  const preshader_real *src0,
+                                  const preshader_real *src1,
+                                  const preshader_real *src2,
+                                  preshader_real *dst)
+{
+    const preshader_vec one = VSPLAT(1.0f);
+    const preshader_vec a = (opcode >= MOJOSHADER_PRESHADEROP_SCALAR_OPS) ?
+                                VSPLAT(src0[0]) : VLOAD(src0);
+    preshader_vec b;
+
+    switch (opcode)
+    {
+        case MOJOSHADER_PRESHADEROP_MOV: VSTORE(dst, a); return 1;
+        case MOJOSHADER_PRESHADEROP_NEG: VSTORE(dst, VNEG(a)); return 1;
+        case MOJOSHADER_PRESHADEROP_RCP: VSTORE(dst, VDIV(one, a)); return 1;
+        default: break;
+    } // switch
+
+    if (src1 == NULL)
+        return 0;
+
+    b = VLOAD(src1);
+    switch (opcode)
+    {
+        case MOJOSHADER_PRESHADEROP_MIN:
+        case MOJOSHADER_PRESHADEROP_MIN_SCALAR:
+            VSTORE(dst, VSELECT(VLT(a, b), a, b));
+            return 1;
+        case MOJOSHADER_PRESHADEROP_MAX:
+        case MOJOSHADER_PRESHADEROP_MAX_SCALAR:
+            VSTORE(dst, VSELECT(VLT(b, a), a, b));
+            return 1;
+        case MOJOSHADER_PRESHADEROP_LT:
+        case MOJOSHADER_PRESHADEROP_LT_SCALAR:
+            VSTORE(dst, VMASK(VLT(a, b), one));
+            return 1;
+        case MOJOSHADER_PRESHADEROP_GE:
+        case MOJOSHADER_PRESHADEROP_GE_SCALAR:
+            VSTORE(dst, VMASK(VGE(a, b), one));
+            return 1;
+        case MOJOSHADER_PRESHADEROP_ADD:
+        case MOJOSHADER_PRESHADEROP_ADD_SCALAR:
+            VSTORE(dst, VADD(a, b));
+            return 1;
+        case MOJOSHADER_PRESHADEROP_MUL:
+        case MOJOSHADER_PRESHADEROP_MUL_SCALAR:
+            VSTORE(dst, VMUL(a, b));
+            return 1;
+        case MOJOSHADER_PRESHADEROP_DIV:
+        case MOJOSHADER_PRESHADEROP_DIV_SCALAR:
+            VSTORE(dst, VDIV(a, b));
+            return 1;
+        case MOJOSHADER_PRESHADEROP_CMP:
+            VSTORE(dst, VSELECT(VGE(a, VSPLAT(0.0f)), b, VLOAD(src2)));
+            return 1;
+        case MOJOSHADER_PRESHADEROP_DOT:
+        {
+            preshader_real final = 0.0f;
+            VSTORE(dst, VMUL(a, b));
+            final += dst[0];
+            final += dst[1];
+            final += dst[2];
+            final += dst[3];
+            VSTORE(dst, VSPLAT(final));
+            return 1;
+        } // case
+        default:
+            return 0;
+    } // switch
+} // runpreshaderop4
+#endif
+
+#endif /* _INCL_MOJOSHADER_PRESHADER_H_ */
+
+// end of mojoshader_preshader.h ...
+
@@ -0,0 +1,7 @@
+/* This file was autogenerated. Do not edit! */
+#ifndef _INCL_MOJOSHADER_VERSION_H_
+#define _INCL_MOJOSHADER_VERSION_H_
+#define MOJOSHADER_VERSION -1
+#define MOJOSHADER_CHANGESET "git-1f5557f93a065d1b5c586e7f5377e8eca4629d71"
+#endif
+
@@ -33,6 +33,8 @@ typedef struct VariableList
     struct VariableList *next;
 } VariableList;
 
+struct RegisterIndex;
+
 typedef struct RegisterList
 {
     RegisterType regtype;
@@ -49,6 +51,7 @@ typedef struct RegisterList
     } spirv;
 #endif
     const VariableList *array;
+    struct RegisterIndex *lookup;  // only used by the list's head.
     struct RegisterList *next;
 } RegisterList;
 
@@ -87,6 +90,7 @@ typedef struct Context
     MOJOSHADER_malloc malloc;
     MOJOSHADER_free free;
     void *malloc_data;
+    Arena scratch;
     int current_position;
     const uint32 *orig_tokens;
     const uint32 *tokens;
@@ -330,6 +334,12 @@ void Free(Context *ctx, void *ptr);
 void * MOJOSHADERCALL MallocBridge(int bytes, void *data);
 void MOJOSHADERCALL FreeBridge(void *ptr, void *data);
 
+// Scratch memory lives until the Context is destroyed, and can't be freed
+//  before that. Never hand it to the app!
+void *ScratchMalloc(Context *ctx, const size_t len);
+void * MOJOSHADERCALL ScratchMallocBridge(int bytes, void *data);
+void MOJOSHADERCALL ScratchFreeBridge(void *ptr, void *data);
+
 int set_output(Context *ctx, Buffer **section);
 void push_output(Context *ctx, Buffer **section);
 void pop_output(Context *ctx);
@@ -359,6 +369,9 @@ RegisterList *reglist_insert(Context *ctx, RegisterList *prev,
 RegisterList *reglist_find(const RegisterList *prev,
                            const RegisterType rtype,
                            const int regnum);
+void reglist_unlink(RegisterList *head, RegisterList *prev, RegisterList *item);
+void reglist_append(Context *ctx, RegisterList *head, RegisterList *tail,
+                    RegisterList *item);
 RegisterList *set_used_register(Context *ctx,
                                 const RegisterType regtype,
                                 const int regnum,
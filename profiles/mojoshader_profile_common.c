@@ -50,6 +50,24 @@ void MOJOSHADERCALL FreeBridge(void *ptr, void *data)
     Free((Context *) data, ptr);
 } // FreeBridge
 
+void *ScratchMalloc(Context *ctx, const size_t len)
+{
+    void *retval = arena_alloc(&ctx->scratch, len);
+    if (retval == NULL)
+        out_of_memory(ctx);
+    return retval;
+} // ScratchMalloc
+
+void * MOJOSHADERCALL ScratchMallocBridge(int bytes, void *data)
+{
+    return ScratchMalloc((Context *) data, (size_t) bytes);
+} // ScratchMallocBridge
+
+void MOJOSHADERCALL ScratchFreeBridge(void *ptr, void *data)
+{
+    // no-op: scratch memory is released all at once in destroy_context().
+} // ScratchFreeBridge
+
 // Jump between output sections in the context...
 
 int set_output(Context *ctx, Buffer **section)
@@ -57,7 +75,7 @@ int set_output(Context *ctx, Buffer **section)
     // only create output sections on first use.
     if (*section == NULL)
     {
-        *section = buffer_create(256, MallocBridge, FreeBridge, ctx);
+        *section = buffer_create(256, ScratchMallocBridge, ScratchFreeBridge, ctx);
         if (*section == NULL)
             return 0;
     } // if
@@ -216,10 +234,151 @@ static inline uint32 reg_to_ui32(const RegisterType regtype, const int regnum)
     return ( ((uint32) regnum) | (((uint32) regtype) << 16) );
 } // reg_to_uint32
 
-// !!! FIXME: ditch this for a hash table.
-RegisterList *reglist_insert(Context *ctx, RegisterList *prev,
-                             const RegisterType regtype,
-                             const int regnum)
+// The lists stay sorted by register type and number, since that's the order
+//  the profiles want to emit declarations in, but each list head also gets
+//  an index: for every register type, a bitmap of the register numbers in
+//  the list and a dense array of the list items themselves. Lookups are a
+//  single array access, and inserting only has to scan the bitmap for the
+//  item to link in after, instead of walking the whole list.
+//
+// The index is built when the first item goes into a list. If we ever fail
+//  to grow it, we throw it away and fall back to walking the list, which is
+//  always correct, just slower.
+
+typedef struct RegisterIndex
+{
+    uint32 *bits[REG_TYPE_MAX + 1];
+    RegisterList **items[REG_TYPE_MAX + 1];
+    int capacity[REG_TYPE_MAX + 1];  // in registers; a multiple of 32.
+    int highest[REG_TYPE_MAX + 1];  // largest regnum in the list, or -1.
+} RegisterIndex;
+
+static inline int reglist_indexable(const RegisterType regtype,
+                                    const int regnum)
+{
+    return ( (((int) regtype) >= 0) && (regtype <= REG_TYPE_MAX) &&
+             (regnum >= 0) && (regnum <= 0xFFFF) );
+} // reglist_indexable
+
+static void reglist_build_index(Context *ctx, RegisterList *head)
+{
+    int i;
+    RegisterIndex *index;
+    if (head->next != NULL)
+        return;  // too late, the index would be missing items.
+
+    index = (RegisterIndex *) ScratchMalloc(ctx, sizeof (RegisterIndex));
+    if (index == NULL)
+        return;
+
+    memset(index, '\0', sizeof (RegisterIndex));
+    for (i = 0; i <= REG_TYPE_MAX; i++)
+        index->highest[i] = -1;
+    head->lookup = index;
+} // reglist_build_index
+
+static int reglist_grow_index(Context *ctx, RegisterIndex *index,
+                              const RegisterType regtype, const int regnum)
+{
+    const int oldcap = index->capacity[regtype];
+    int newcap = (oldcap > 0) ? oldcap : 32;
+    while (newcap <= regnum)
+        newcap *= 2;
+
+    // The old arrays are scratch memory, so we just abandon them.
+    uint32 *bits = (uint32 *) ScratchMalloc(ctx, (newcap / 32) * sizeof (uint32));
+    RegisterList **items = (RegisterList **) ScratchMalloc(ctx, newcap * sizeof (RegisterList *));
+    if ((bits == NULL) || (items == NULL))
+        return 0;
+
+    memset(bits, '\0', (newcap / 32) * sizeof (uint32));
+    memset(items, '\0', newcap * sizeof (RegisterList *));
+    if (oldcap > 0)
+    {
+        memcpy(bits, index->bits[regtype], (oldcap / 32) * sizeof (uint32));
+        memcpy(items, index->items[regtype], oldcap * sizeof (RegisterList *));
+    } // if
+
+    index->bits[regtype] = bits;
+    index->items[regtype] = items;
+    index->capacity[regtype] = newcap;
+    return 1;
+} // reglist_grow_index
+
+// Highest register number of (regtype) in the list that's less than
+//  (regnum), or -1 if there isn't one.
+static int reglist_index_below(const RegisterIndex *index,
+                               const RegisterType regtype, int regnum)
+{
+    const uint32 *bits = index->bits[regtype];
+    if (regnum > index->capacity[regtype])
+        regnum = index->capacity[regtype];
+
+    regnum--;
+    while (regnum >= 0)
+    {
+        uint32 word = bits[regnum / 32];
+        const int bit = regnum % 32;
+        if (bit < 31)
+            word &= ((((uint32) 1) << (bit + 1)) - 1);  // drop higher bits.
+
+        if (word == 0)
+            regnum = (regnum - bit) - 1;  // skip to the previous word.
+        else
+        {
+            int highbit = 31;
+            while ((word & (((uint32) 1) << highbit)) == 0)
+                highbit--;
+            return (regnum - bit) + highbit;
+        } // else
+    } // while
+
+    return -1;
+} // reglist_index_below
+
+static RegisterList *reglist_index_predecessor(RegisterList *head,
+                                               const RegisterType regtype,
+                                               const int regnum)
+{
+    const RegisterIndex *index = head->lookup;
+    const int num = reglist_index_below(index, regtype, regnum);
+    int i;
+
+    if (num >= 0)
+        return index->items[regtype][num];
+
+    for (i = ((int) regtype) - 1; i >= 0; i--)
+    {
+        if (index->highest[i] >= 0)
+            return index->items[i][index->highest[i]];
+    } // for
+
+    return head;  // goes at the start of the list.
+} // reglist_index_predecessor
+
+static int reglist_index_add(Context *ctx, RegisterIndex *index,
+                             RegisterList *item)
+{
+    const RegisterType regtype = item->regtype;
+    const int regnum = item->regnum;
+
+    if (!reglist_indexable(regtype, regnum))
+        return 0;
+    else if ( (regnum >= index->capacity[regtype]) &&
+              (!reglist_grow_index(ctx, index, regtype, regnum)) )
+        return 0;
+
+    index->bits[regtype][regnum / 32] |= ((uint32) 1) << (regnum % 32);
+    index->items[regtype][regnum] = item;
+    if (regnum > index->highest[regtype])
+        index->highest[regtype] = regnum;
+    return 1;
+} // reglist_index_add
+
+static RegisterList *reglist_insert_slow(RegisterList *prev,
+                                         const RegisterType regtype,
+                                         const int regnum,
+                                         RegisterList **_prev)
 {
     const uint32 newval = reg_to_ui32(regtype, regnum);
     RegisterList *item = prev->next;
@@ -238,8 +397,36 @@ RegisterList *reglist_insert(Context *ctx, RegisterList *prev,
         } // else
     } // while
 
+    *_prev = prev;
+    return NULL;
+} // reglist_insert_slow
+
+RegisterList *reglist_insert(Context *ctx, RegisterList *prev,
+                             const RegisterType regtype,
+                             const int regnum)
+{
+    RegisterList *head = prev;
+    RegisterList *item = NULL;
+
+    if ((head->lookup == NULL) && (head->next == NULL))
+        reglist_build_index(ctx, head);
+
+    if ((head->lookup != NULL) && (reglist_indexable(regtype, regnum)))
+    {
+        item = reglist_find(head, regtype, regnum);
+        if (item != NULL)
+            return item;  // already set, so we're done.
+        prev = reglist_index_predecessor(head, regtype, regnum);
+    } // if
+    else
+    {
+        item = reglist_insert_slow(head, regtype, regnum, &prev);
+        if (item != NULL)
+            return item;  // already set, so we're done.
+    } // else
+
     // we need to insert an entry after (prev).
-    item = (RegisterList *) Malloc(ctx, sizeof (RegisterList));
+    item = (RegisterList *) ScratchMalloc(ctx, sizeof (RegisterList));
     if (item != NULL)
     {
         item->regtype = regtype;
@@ -254,8 +441,12 @@ RegisterList *reglist_insert(Context *ctx, RegisterList *prev,
         item->spirv.is_ssa = 0;
 #endif
         item->array = NULL;
+        item->lookup = NULL;
         item->next = prev->next;
         prev->next = item;
+
+        if ((head->lookup != NULL) && (!reglist_index_add(ctx, head->lookup, item)))
+            head->lookup = NULL;  // give up on the index for this list.
     } // if
 
     return item;
@@ -265,6 +456,14 @@ RegisterList *reglist_find(const RegisterList *prev,
                            const RegisterType rtype,
                            const int regnum)
 {
+    const RegisterIndex *index = prev->lookup;
+    if ((index != NULL) && (reglist_indexable(rtype, regnum)))
+    {
+        if (regnum >= index->capacity[rtype])
+            return NULL;
+        return index->items[rtype][regnum];
+    } // if
+
     const uint32 newval = reg_to_ui32(rtype, regnum);
     RegisterList *item = prev->next;
     while (item != NULL)
@@ -281,6 +480,43 @@ RegisterList *reglist_find(const RegisterList *prev,
     return NULL;  // wasn't in the list.
 } // reglist_find
 
+void reglist_unlink(RegisterList *head, RegisterList *prev, RegisterList *item)
+{
+    RegisterIndex *index = head->lookup;
+    assert(prev->next == item);
+    prev->next = item->next;
+    item->next = NULL;
+
+    if ((index != NULL) && (reglist_indexable(item->regtype, item->regnum)))
+    {
+        const RegisterType regtype = item->regtype;
+        const int regnum = item->regnum;
+        index->bits[regtype][regnum / 32] &= ~(((uint32) 1) << (regnum % 32));
+        index->items[regtype][regnum] = NULL;
+        if (index->highest[regtype] == regnum)
+            index->highest[regtype] = reglist_index_below(index, regtype, regnum);
+    } // if
+} // reglist_unlink
+
+void reglist_append(Context *ctx, RegisterList *head, RegisterList *tail,
+                    RegisterList *item)
+{
+    // the caller promises this keeps the list sorted.
+    assert(tail->next == NULL);
+    assert((tail == head) ||
+           (reg_to_ui32(tail->regtype, tail->regnum) <
+            reg_to_ui32(item->regtype, item->regnum)));
+
+    if ((head->lookup == NULL) && (head->next == NULL))
+        reglist_build_index(ctx, head);
+
+    item->next = NULL;
+    tail->next = item;
+
+    if ((head->lookup != NULL) && (!reglist_index_add(ctx, head->lookup, item)))
+        head->lookup = NULL;  // give up on the index for this list.
+} // reglist_append
+
 RegisterList *set_used_register(Context *ctx,
                                 const RegisterType regtype,
                                 const int regnum,
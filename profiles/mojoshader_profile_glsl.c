@@ -642,6 +642,33 @@ void output_GLSL_uniform_array(Context *ctx, const RegisterType regtype,
                 return;
             } // default
         } // switch
+
+#ifdef MOJOSHADER_GLSL_UNIFORM_BUFFERS
+        // Put the float4 registers in a std140 block, so the OpenGL glue can
+        //  switch programs by binding a buffer range instead of uploading
+        //  the whole array again. A vec4 array's std140 stride is 16 bytes,
+        //  so the block has the same layout as the register file.
+        if ((regtype == REG_TYPE_CONST) &&
+            (support_glsl120(ctx) || support_glsles3(ctx)))
+        {
+            const char *shadertype = ctx->shader_type_str;
+            if (!support_glsles3(ctx))
+            {
+                output_line(ctx, "#if GL_ARB_uniform_buffer_object");
+                output_line(ctx, "#extension GL_ARB_uniform_buffer_object : enable");
+            } // if
+            output_line(ctx, "layout(std140) uniform %s_uniforms_block { %s %s[%d]; };",
+                        shadertype, typ, buf, size);
+            if (!support_glsles3(ctx))
+            {
+                output_line(ctx, "#else");
+                output_line(ctx, "uniform %s %s[%d];", typ, buf, size);
+                output_line(ctx, "#endif");
+            } // if
+            return;
+        } // if
+#endif
+
         output_line(ctx, "uniform %s %s[%d];", typ, buf, size);
     } // if
 } // output_GLSL_uniform_array
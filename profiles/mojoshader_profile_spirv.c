@@ -70,27 +70,6 @@ static RegisterList *spv_getreg(Context *ctx, const RegisterType regtype, const
     return r;
 } // spv_getreg
 
-static void spv_componentlist_free(Context *ctx, ComponentList *cl)
-{
-    ComponentList *next;
-    while (cl)
-    {
-        next = cl->next;
-        Free(ctx, cl);
-        cl = next;
-    } // while
-} // spv_componentlist_free
-
-static ComponentList *spv_componentlist_alloc(Context *ctx)
-{
-    ComponentList *ret = (ComponentList *) Malloc(ctx, sizeof(ComponentList));
-    if (!ret) return NULL;
-    ret->id = 0;
-    ret->v.i = 0;
-    ret->next = NULL;
-    return ret;
-} // spv_componentlist_alloc
-
 static const char *get_SPIRV_varname_in_buf(Context *ctx, const RegisterType rt,
                                            const int regnum, char *buf,
                                            const size_t buflen)
@@ -453,73 +432,99 @@ static uint32 spv_getext(Context *ctx)
     return ctx->spirv.idext = spv_bumpid(ctx);
 } // spv_getext
 
-static uint32 spv_output_scalar(Context *ctx, ComponentList *cl,
-                             MOJOSHADER_attributeType type)
+static uint32 spv_hash_constant(const void *key, void *data)
 {
-    uint32 idret, idtype;
-    if (type == MOJOSHADER_ATTRIBUTE_FLOAT)
-        idtype = spv_get_type(ctx, STI_FLOAT);
-    else if (type == MOJOSHADER_ATTRIBUTE_INT)
-        idtype = spv_get_type(ctx, STI_INT);
-    else if (type == MOJOSHADER_ATTRIBUTE_UINT)
-        idtype = spv_get_type(ctx, STI_UINT);
-    else
+    (void) data;
+    const SpirvConstant *c = (const SpirvConstant *) key;
+    uint32 hash = c->tid ^ (c->count << 24);
+    uint32 i;
+    for (i = 0; i < c->count; i++)
+        hash = ((hash << 5) + hash) ^ c->words[i];
+    return hash;
+} // spv_hash_constant
+
+static int spv_match_constant(const void *_a, const void *_b, void *data)
+{
+    (void) data;
+    const SpirvConstant *a = (const SpirvConstant *) _a;
+    const SpirvConstant *b = (const SpirvConstant *) _b;
+    return ( (a->tid == b->tid) && (a->count == b->count) &&
+             (memcmp(a->words, b->words, a->count * sizeof (uint32)) == 0) );
+} // spv_match_constant
+
+static void spv_nuke_constant(const void *ctx, const void *key,
+                              const void *value, void *data)
+{
+    // keys live in the scratch arena, nothing to do here.
+} // spv_nuke_constant
+
+// Retrieve the result id of an OpConstant or OpConstantComposite with the
+// given result type and operands, or generate a new one. If the pool can't
+// be allocated we still emit a correct constant, it just isn't shared.
+static uint32 spv_getconstant(Context *ctx, SpvOp op, uint32 tid,
+                              const uint32 *words, uint32 count)
+{
+    SpirvConstant key;
+    SpirvConstant *item;
+    const void *value = NULL;
+    uint32 i, id;
+
+    assert(count > 0 && count <= STATICARRAYLEN(key.words));
+    key.tid = tid;
+    key.count = count;
+    memcpy(key.words, words, count * sizeof (uint32));
+
+    if (ctx->spirv.constants == NULL)
     {
-        failf(ctx, "spv_output_scalar: invalid attribute type %d", type);
-        return 0;
-    } // else
-    idret = spv_bumpid(ctx);
+        ctx->spirv.constants = hash_create(NULL, spv_hash_constant,
+                                           spv_match_constant,
+                                           spv_nuke_constant, 0,
+                                           ScratchMallocBridge,
+                                           ScratchFreeBridge, ctx);
+    } // if
 
+    if (ctx->spirv.constants && hash_find(ctx->spirv.constants, &key, &value))
+        return ((const SpirvConstant *) value)->id;
+
+    id = spv_bumpid(ctx);
     push_output(ctx, &ctx->mainline_intro);
-    spv_emit(ctx, 4, SpvOpConstant, idtype, idret, cl->v.u);
+    spv_emit_part(ctx, 3 + count, 3, op, tid, id);
+    for (i = 0; i < count; i++)
+        spv_emit_word(ctx, words[i]);
     pop_output(ctx);
-    return idret;
-} // spv_output_scalar
+
+    if (ctx->spirv.constants)
+    {
+        item = (SpirvConstant *) ScratchMalloc(ctx, sizeof (SpirvConstant));
+        if (item != NULL)
+        {
+            *item = key;
+            item->id = id;
+            hash_insert(ctx->spirv.constants, item, item);
+        } // if
+    } // if
+
+    return id;
+} // spv_getconstant
 
 // The spv_getscalar* functions retrieve the result id of an OpConstant
 // instruction with the corresponding value v, or generate a new one.
 static uint32 spv_getscalarf(Context *ctx, float v)
 {
-    ComponentList *prev = &(ctx->spirv.cl.f), *cl = ctx->spirv.cl.f.next;
-    while (cl)
-    {
-        if (v == cl->v.f)
-            return cl->id;
-        else if (v < cl->v.f)
-            break;
-        prev = cl;
-        cl = cl->next;
-    } // while
-    cl = spv_componentlist_alloc(ctx);
-    cl->next = prev->next;
-    prev->next = cl;
-    cl->v.f = v;
-    cl->id = spv_output_scalar(ctx, cl, MOJOSHADER_ATTRIBUTE_FLOAT);
-    return cl->id;
+    union { float f; uint32 u; } bits;
+    bits.f = v;
+    return spv_getconstant(ctx, SpvOpConstant, spv_get_type(ctx, STI_FLOAT), &bits.u, 1);
 } // spv_getscalarf
 
 static uint32 spv_getscalari(Context *ctx, int v)
 {
-    ComponentList *prev = &(ctx->spirv.cl.i), *cl = ctx->spirv.cl.i.next;
-    while (cl)
-    {
-        if (v == cl->v.i)
-            return cl->id;
-        else if (v < cl->v.i)
-            break;
-        prev = cl;
-        cl = cl->next;
-    } // while
-    cl = spv_componentlist_alloc(ctx);
-    cl->next = prev->next;
-    prev->next = cl;
-    cl->v.i = v;
-    cl->id = spv_output_scalar(ctx, cl, MOJOSHADER_ATTRIBUTE_INT);
-    return cl->id;
+    const uint32 u = (uint32) v;
+    return spv_getconstant(ctx, SpvOpConstant, spv_get_type(ctx, STI_INT), &u, 1);
 } // spv_getscalari
 
 static uint32 spv_get_constant_composite(Context *ctx, uint32 tid, uint32* cache, float scalar)
 {
+    uint32 sids[4];
     uint32 i;
 
     assert(tid != 0);
@@ -539,12 +544,9 @@ static uint32 spv_get_constant_composite(Context *ctx, uint32 tid, uint32* cache
         return sid;
     } // if
 
-    id = spv_bumpid(ctx);
-    push_output(ctx, &ctx->mainline_intro);
-    spv_emit_part(ctx, 3 + dim, 3, SpvOpConstantComposite, tid, id);
     for (i = 0; i < dim; i++)
-        spv_emit_word(ctx, sid);
-    pop_output(ctx);
+        sids[i] = sid;
+    id = spv_getconstant(ctx, SpvOpConstantComposite, tid, sids, dim);
     cache[dim - 1] = id;
     return id;
 } // spv_get_constant_composite
@@ -2072,14 +2074,13 @@ void emit_SPIRV_const_array(Context *ctx,
             clist = clist->next;
         assert(clist->constant.index == (base + i));
 
-        uint32 id_x = spv_getscalarf(ctx, clist->constant.value.f[0]);
-        uint32 id_y = spv_getscalarf(ctx, clist->constant.value.f[1]);
-        uint32 id_z = spv_getscalarf(ctx, clist->constant.value.f[2]);
-        uint32 id_w = spv_getscalarf(ctx, clist->constant.value.f[3]);
-
-        uint32 id = spv_bumpid(ctx);
-        spv_emit(ctx, 3 + 4, SpvOpConstantComposite, tid_constituent, id, id_x, id_y, id_z, id_w);
-        constituents[i] = id;
+        uint32 ids[4];
+        ids[0] = spv_getscalarf(ctx, clist->constant.value.f[0]);
+        ids[1] = spv_getscalarf(ctx, clist->constant.value.f[1]);
+        ids[2] = spv_getscalarf(ctx, clist->constant.value.f[2]);
+        ids[3] = spv_getscalarf(ctx, clist->constant.value.f[3]);
+        constituents[i] = spv_getconstant(ctx, SpvOpConstantComposite,
+                                          tid_constituent, ids, 4);
 
         clist = clist->next;
     } // for
@@ -2788,10 +2789,6 @@ void emit_SPIRV_finalize(Context *ctx)
     push_output(ctx, &ctx->postflight);
     buffer_append(ctx->output, &ctx->spirv.patch_table, sizeof(ctx->spirv.patch_table));
     pop_output(ctx);
-
-    spv_componentlist_free(ctx, ctx->spirv.cl.f.next);
-    spv_componentlist_free(ctx, ctx->spirv.cl.i.next);
-    spv_componentlist_free(ctx, ctx->spirv.cl.u.next);
 } // emit_SPIRV_finalize
 
 void emit_SPIRV_NOP(Context *ctx)
@@ -20,19 +20,18 @@
 // For baked-in constants in SPIR-V we want to store scalar values that we can
 // use in composites, since OpConstantComposite uses result ids constituates
 // rather than value literals.
-// We'll store these lists grouped by type and have the lists themselves
-// ordered by value in the ctx.spirv struct.
-typedef struct ComponentList
+// Every OpConstant and pooled OpConstantComposite we emit is kept in a hash
+// table in the ctx.spirv struct, keyed by its result type and operands, so
+// each distinct value is only emitted once. Scalars are keyed by their raw
+// 32-bit value, composites by the result ids of their constituents.
+typedef struct SpirvConstant
 {
-    // result id from OpConstant
+    uint32 tid;
+    uint32 count;
+    uint32 words[4];
+    // result id from OpConstant/OpConstantComposite
     uint32 id;
-    union {
-        float f;
-        int i;
-        uint32 u;
-    } v;
-    struct ComponentList *next;
-} ComponentList;
+} SpirvConstant;
 
 typedef struct SpirvLoopInfo
 {
@@ -201,11 +200,7 @@ typedef struct SpirvContext
     struct {
         uint32 idvec4;
     } constant_arrays;
-    struct {
-        ComponentList f;
-        ComponentList i;
-        ComponentList u;
-    } cl;
+    HashTable *constants;  // SpirvConstant -> result id, in scratch memory.
 
     SpirvPatchTable patch_table;
 
@@ -793,6 +793,11 @@ static void close_include(const char *data, MOJOSHADER_malloc m,
     f((void *) data, d);
 } // close_include
 
+// Without any -I paths, we let MojoShader use its own file reader, which
+//  does the same as open_include() would, and can skip guarded headers.
+static MOJOSHADER_includeOpen include_open = open_include;
+static MOJOSHADER_includeClose include_close = close_include;
+
 
 static int preprocess(const char *fname, const char *buf, int len,
                       const char *outfile,
@@ -802,8 +807,8 @@ static int preprocess(const char *fname, const char *buf, int len,
     const MOJOSHADER_preprocessData *pd;
     int retval = 0;
 
-    pd = MOJOSHADER_preprocess(fname, buf, len, defs, defcount, open_include,
-                               close_include, Malloc, Free, NULL);
+    pd = MOJOSHADER_preprocess(fname, buf, len, defs, defcount, include_open,
+                               include_close, NULL, Malloc, Free, NULL);
 
     if (pd->error_count > 0)
     {
@@ -844,7 +849,7 @@ static int assemble(const char *fname, const char *buf, int len,
     int retval = 0;
 
     pd = MOJOSHADER_assemble(fname, buf, len, NULL, 0, NULL, 0,
-                             defs, defcount, open_include, close_include,
+                             defs, defcount, include_open, include_close,
                              Malloc, Free, NULL);
 
     if (pd->error_count > 0)
@@ -885,7 +890,7 @@ static int ast(const char *fname, const char *buf, int len,
 
     ad = MOJOSHADER_parseAst(MOJOSHADER_SRC_PROFILE_HLSL_PS_1_1,  // !!! FIXME
                         fname, buf, len, defs, defcount,
-                        open_include, close_include, Malloc, Free, NULL);
+                        include_open, include_close, Malloc, Free, NULL);
     
     if (ad->error_count > 0)
     {
@@ -922,7 +927,7 @@ static int compile(const char *fname, const char *buf, int len,
 
     MOJOSHADER_compile(MOJOSHADER_SRC_PROFILE_HLSL_PS_1_1,  // !!! FIXME
                         fname, buf, len, defs, defcount,
-                             open_include, close_include,
+                             include_open, include_close,
                              Malloc, Free, NULL);
     return 1;
 } // compile
@@ -1046,6 +1051,12 @@ int main(int argc, char **argv)
     if (action == ACTION_UNKNOWN)
         action = ACTION_ASSEMBLE;
 
+    if (include_path_count == 1)  // just "."
+    {
+        include_open = NULL;
+        include_close = NULL;
+    } // if
+
     if (action == ACTION_VERSION)
     {
         printf("mojoshader-compiler, changeset %s\n", MOJOSHADER_CHANGESET);
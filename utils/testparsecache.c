@@ -0,0 +1,266 @@
+/**
+ * MojoShader; generate shader programs from bytecode of compiled
+ *  Direct3D shaders.
+ *
+ * Please see the file LICENSE.txt in the source's root directory.
+ *
+ *  This file written by Ryan C. Gordon.
+ */
+
+// Checks that translations survive a trip through the translation cache:
+//  MOJOSHADER_serializeParseData() -> MOJOSHADER_deserializeParseData(),
+//  and MOJOSHADER_parseCached() storing a file and loading it back.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "mojoshader.h"
+
+#ifndef _WIN32
+#include <dirent.h>
+#endif
+
+static const char *profiles[] = {
+    MOJOSHADER_PROFILE_D3D, MOJOSHADER_PROFILE_BYTECODE,
+    MOJOSHADER_PROFILE_HLSL, MOJOSHADER_PROFILE_GLSL,
+    MOJOSHADER_PROFILE_GLSL120, MOJOSHADER_PROFILE_GLSLES,
+    MOJOSHADER_PROFILE_GLSLES3, MOJOSHADER_PROFILE_ARB1,
+    MOJOSHADER_PROFILE_NV2, MOJOSHADER_PROFILE_NV3, MOJOSHADER_PROFILE_NV4,
+    MOJOSHADER_PROFILE_METAL, MOJOSHADER_PROFILE_SPIRV,
+    MOJOSHADER_PROFILE_GLSPIRV,
+};
+
+// Built-in shaders, so we cover samplers, constants, outputs and symbols.
+static const char *sources[] = {
+    "vs_3_0\n"
+    "def c10, 1.0, 0.5, 0.25, 0.0\n"
+    "dcl_position v0\n"
+    "dcl_texcoord0 v1\n"
+    "dcl_normal v2\n"
+    "dcl_position o0\n"
+    "dcl_texcoord0 o1\n"
+    "dcl_texcoord1 o2\n"
+    "dcl_2d s0\n"
+    "m4x4 o0, v0, c0\n"
+    "texldl r0, v1, s0\n"
+    "mul o1, r0, c10\n"
+    "dp3 o2.x, v2, c4\n"
+    "mov o2.yzw, c10\n",
+
+    "ps_2_0\n"
+    "def c1, 0.5, 0.5, 0.5, 1.0\n"
+    "dcl t0.xy\n"
+    "dcl v0\n"
+    "dcl_2d s0\n"
+    "texld r0, t0, s0\n"
+    "mul r0, r0, v0\n"
+    "mad r0, r0, c0, c1\n"
+    "mov oC0, r0\n",
+};
+
+static const MOJOSHADER_symbol symbols[] = {
+    { "WorldViewProj", MOJOSHADER_SYMREGSET_FLOAT4, 0, 4,
+      { MOJOSHADER_SYMCLASS_MATRIX_COLUMNS, MOJOSHADER_SYMTYPE_FLOAT,
+        4, 4, 1, 0, NULL } },
+    { "Tint", MOJOSHADER_SYMREGSET_FLOAT4, 4, 1,
+      { MOJOSHADER_SYMCLASS_VECTOR, MOJOSHADER_SYMTYPE_FLOAT,
+        1, 4, 1, 0, NULL } },
+};
+
+static int count_cache_files(const char *cachedir)
+{
+#ifdef _WIN32
+    return -1;  // don't bother; we just skip this check.
+#else
+    int retval = 0;
+    DIR *dirp = opendir(cachedir);
+    struct dirent *dent;
+    if (dirp == NULL)
+        return -1;
+    while ((dent = readdir(dirp)) != NULL)
+    {
+        if (dent->d_name[0] != '.')
+            retval++;
+    } // while
+    closedir(dirp);
+    return retval;
+#endif
+} // count_cache_files
+
+// The serialized form covers every field, so two results are the same if
+//  their blobs are.
+static int same_blob(const MOJOSHADER_parseData *a,
+                     const MOJOSHADER_parseData *b)
+{
+    unsigned int alen = 0, blen = 0;
+    void *ablob = MOJOSHADER_serializeParseData(a, &alen, NULL, NULL, NULL);
+    void *bblob = MOJOSHADER_serializeParseData(b, &blen, NULL, NULL, NULL);
+    const int retval = ( (ablob != NULL) && (bblob != NULL) &&
+                         (alen == blen) && (memcmp(ablob, bblob, alen) == 0) );
+    free(ablob);
+    free(bblob);
+    return retval;
+} // same_blob
+
+// Returns 1 if (buf) survives the cache, 0 if not, and -1 if (prof) can't
+//  translate it in the first place.
+static int check(const char *cachedir, const char *fname,
+                 const unsigned char *buf, const unsigned int len,
+                 const char *prof, int *files)
+{
+    const MOJOSHADER_parseData *pd;
+    const MOJOSHADER_parseData *loaded;
+    const MOJOSHADER_parseData *stored;
+    unsigned int bloblen = 0;
+    void *blob;
+    int nowfiles;
+    int retval = 1;
+
+    pd = MOJOSHADER_parse(prof, NULL, buf, len, NULL, 0, NULL, 0, NULL, NULL, NULL);
+    if (pd->error_count > 0)
+    {
+        // not every profile takes every shader; that's fine.
+        MOJOSHADER_freeParseData(pd);
+        return -1;
+    } // if
+
+    blob = MOJOSHADER_serializeParseData(pd, &bloblen, NULL, NULL, NULL);
+    loaded = MOJOSHADER_deserializeParseData(blob, bloblen, NULL, NULL, NULL);
+    if (loaded == NULL)
+    {
+        printf("%s (%s): couldn't deserialize\n", fname, prof);
+        retval = 0;
+    } // if
+    else if (!same_blob(pd, loaded))
+    {
+        printf("%s (%s): deserialized data doesn't match\n", fname, prof);
+        retval = 0;
+    } // else if
+    MOJOSHADER_freeParseData(loaded);
+
+    // a truncated blob must be rejected, not half-loaded.
+    if ((blob != NULL) && (bloblen > 0))
+    {
+        loaded = MOJOSHADER_deserializeParseData(blob, bloblen - 1, NULL, NULL, NULL);
+        if (loaded != NULL)
+        {
+            printf("%s (%s): accepted a truncated blob\n", fname, prof);
+            MOJOSHADER_freeParseData(loaded);
+            retval = 0;
+        } // if
+    } // if
+    free(blob);
+
+    // The first call translates and stores; the second loads that file.
+    stored = MOJOSHADER_parseCached(cachedir, prof, NULL, buf, len, NULL, 0,
+                                    NULL, 0, NULL, NULL, NULL);
+    nowfiles = count_cache_files(cachedir);
+    if ((nowfiles >= 0) && (nowfiles != *files + 1))
+    {
+        printf("%s (%s): expected one new cache file, found %d\n",
+               fname, prof, nowfiles - *files);
+        retval = 0;
+    } // if
+    *files = nowfiles;
+
+    loaded = MOJOSHADER_parseCached(cachedir, prof, NULL, buf, len, NULL, 0,
+                                    NULL, 0, NULL, NULL, NULL);
+    if (!same_blob(pd, stored) || !same_blob(pd, loaded))
+    {
+        printf("%s (%s): cached data doesn't match\n", fname, prof);
+        retval = 0;
+    } // if
+
+    MOJOSHADER_freeParseData(loaded);
+    MOJOSHADER_freeParseData(stored);
+    MOJOSHADER_freeParseData(pd);
+    return retval;
+} // check
+
+int main(int argc, char **argv)
+{
+    int retval = 0;
+    int checked = 0;
+
+    if (argc < 2)
+        printf("\n\nUSAGE: %s <emptycachedir> [file1] ... [fileN]\n\n", argv[0]);
+    else
+    {
+        const char *cachedir = argv[1];
+        int files = count_cache_files(cachedir);
+        int i;
+        size_t j;
+
+        if (files > 0)
+        {
+            printf("'%s' isn't empty.\n", cachedir);
+            return 1;
+        } // if
+
+        for (i = 0; i < (int) (sizeof (sources) / sizeof (sources[0])); i++)
+        {
+            const MOJOSHADER_parseData *a;
+            char name[32];
+            snprintf(name, sizeof (name), "builtin #%d", i);
+            a = MOJOSHADER_assemble(name, sources[i],
+                                    (unsigned int) strlen(sources[i]),
+                                    NULL, 0, symbols,
+                                    sizeof (symbols) / sizeof (symbols[0]),
+                                    NULL, 0, NULL, NULL, NULL, NULL, NULL);
+            if (a->error_count > 0)
+            {
+                printf("%s: %s\n", name, a->errors[0].error);
+                retval = 1;
+            } // if
+            else
+            {
+                for (j = 0; j < sizeof (profiles) / sizeof (profiles[0]); j++)
+                {
+                    const int rc = check(cachedir, name,
+                                         (const unsigned char *) a->output,
+                                         (unsigned int) a->output_len,
+                                         profiles[j], &files);
+                    if (rc == 0)
+                        retval = 1;
+                    else if (rc > 0)
+                        checked++;
+                } // for
+            } // else
+            MOJOSHADER_freeParseData(a);
+        } // for
+
+        for (i = 2; i < argc; i++)
+        {
+            FILE *io = fopen(argv[i], "rb");
+            if (io == NULL)
+            {
+                printf(" ... fopen('%s') failed.\n", argv[i]);
+                retval = 1;
+            } // if
+            else
+            {
+                unsigned char *buf = (unsigned char *) malloc(1000000);
+                int rc = fread(buf, 1, 1000000, io);
+                fclose(io);
+                for (j = 0; j < sizeof (profiles) / sizeof (profiles[0]); j++)
+                {
+                    const int ok = check(cachedir, argv[i], buf, rc,
+                                         profiles[j], &files);
+                    if (ok == 0)
+                        retval = 1;
+                    else if (ok > 0)
+                        checked++;
+                } // for
+                free(buf);
+            } // else
+        } // for
+
+        printf("%d translations checked against the cache, %s.\n",
+               checked, retval ? "FAILED" : "all matched");
+    } // else
+
+    return retval;
+} // main
+
+// end of testparsecache.c ...
+
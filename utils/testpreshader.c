@@ -0,0 +1,365 @@
+/**
+ * MojoShader; generate shader programs from bytecode of compiled
+ *  Direct3D shaders.
+ *
+ * Please see the file LICENSE.txt in the source's root directory.
+ *
+ *  This file written by Ryan C. Gordon.
+ */
+
+// Checks that the four-wide preshader ops give exactly what the scalar ones
+//  do, on random inputs, and that effects running the preshaders in the
+//  files on the command line get what MOJOSHADER_runPreshader() does.
+
+#define __MOJOSHADER_INTERNAL__ 1
+#include "mojoshader_internal.h"
+#include "mojoshader_preshader.h"
+#include "mojoshader_effects.h"
+
+static uint32 rngstate = 0x12345678;
+
+static uint32 rng(void)
+{
+    // xorshift32; we want the same inputs on every platform.
+    rngstate ^= rngstate << 13;
+    rngstate ^= rngstate >> 17;
+    rngstate ^= rngstate << 5;
+    return rngstate;
+} // rng
+
+#ifdef PRESHADER_SIMD
+static const uint32 opcodes[] = {
+    MOJOSHADER_PRESHADEROP_MOV, MOJOSHADER_PRESHADEROP_NEG,
+    MOJOSHADER_PRESHADEROP_RCP, MOJOSHADER_PRESHADEROP_MIN,
+    MOJOSHADER_PRESHADEROP_MAX, MOJOSHADER_PRESHADEROP_LT,
+    MOJOSHADER_PRESHADEROP_GE, MOJOSHADER_PRESHADEROP_ADD,
+    MOJOSHADER_PRESHADEROP_MUL, MOJOSHADER_PRESHADEROP_DIV,
+    MOJOSHADER_PRESHADEROP_CMP, MOJOSHADER_PRESHADEROP_DOT,
+    MOJOSHADER_PRESHADEROP_MIN_SCALAR, MOJOSHADER_PRESHADEROP_MAX_SCALAR,
+    MOJOSHADER_PRESHADEROP_LT_SCALAR, MOJOSHADER_PRESHADEROP_GE_SCALAR,
+    MOJOSHADER_PRESHADEROP_ADD_SCALAR, MOJOSHADER_PRESHADEROP_MUL_SCALAR,
+    MOJOSHADER_PRESHADEROP_DIV_SCALAR,
+};
+
+static float random_input(void)
+{
+    static const float special[] = {
+        0.0f, -0.0f, 1.0f, -1.0f, 0.5f, 3.0f, -7.25f, 1e30f, -1e30f,
+        1e-38f, 1e-40f, -1e-40f, FLT_MAX, -FLT_MAX,
+    };
+    const uint32 r = rng();
+
+    switch (r % 8)
+    {
+        case 0:
+            return special[(r >> 3) % STATICARRAYLEN(special)];
+        case 1:
+        {
+            // any bit pattern at all: denormals, infinities, NaNs...
+            const uint32 bits = rng();
+            float f;
+            memcpy(&f, &bits, sizeof (f));
+            return f;
+        } // case
+        case 2:
+            return ((r >> 3) & 1) ? INFINITY : -INFINITY;
+        case 3:
+            return NAN;
+        default:
+            return (((float) (rng() & 0xFFFFFF) / 16777216.0f) - 0.5f) * 200.0f;
+    } // switch
+} // random_input
+
+static int same_result(const float a, const float b)
+{
+    // NaN payloads can differ between scalar and vector units; NaN is NaN.
+    if (isnan(a) || isnan(b))
+        return isnan(a) && isnan(b);
+    return memcmp(&a, &b, sizeof (a)) == 0;
+} // same_result
+
+static int check_ops(const int iterations)
+{
+    int failures = 0;
+    int compared = 0;
+    size_t op;
+    int i, j;
+
+    for (op = 0; op < STATICARRAYLEN(opcodes); op++)
+    {
+        for (i = 0; i < iterations; i++)
+        {
+            float src[3][4], scalar[4], vector[4];
+            for (j = 0; j < 12; j++)
+                src[j / 4][j % 4] = random_input();
+
+            runpreshaderop(opcodes[op], 4, src[0], src[1], src[2], scalar);
+            if (!runpreshaderop4(opcodes[op], src[0], src[1], src[2], vector))
+            {
+                printf("opcode %u has no four-wide version\n", opcodes[op]);
+                return 0;
+            } // if
+
+            compared++;
+            for (j = 0; j < 4; j++)
+            {
+                if (!same_result(scalar[j], vector[j]))
+                    break;
+            } // for
+
+            if ((j < 4) && (failures++ < 10))
+            {
+                printf("opcode %u: (%a %a %a %a) (%a %a %a %a) (%a %a %a %a)\n"
+                       "  scalar: %a %a %a %a\n  vector: %a %a %a %a\n",
+                       opcodes[op],
+                       src[0][0], src[0][1], src[0][2], src[0][3],
+                       src[1][0], src[1][1], src[1][2], src[1][3],
+                       src[2][0], src[2][1], src[2][2], src[2][3],
+                       scalar[0], scalar[1], scalar[2], scalar[3],
+                       vector[0], vector[1], vector[2], vector[3]);
+            } // if
+        } // for
+    } // for
+
+    printf("%d four-wide preshader ops compared, %d mismatches.\n",
+           compared, failures);
+    return (failures == 0);
+} // check_ops
+#endif
+
+// Just enough of a backend to run an effect: shaders are their parse data.
+#define MAX_REGS 256
+static float vs_regs[MAX_REGS * 4], ps_regs[MAX_REGS * 4];
+static int vs_regi[MAX_REGS * 4], ps_regi[MAX_REGS * 4];
+static unsigned char vs_regb[MAX_REGS], ps_regb[MAX_REGS];
+static void *bound_vert, *bound_pixl;
+
+static void *MOJOSHADERCALL fake_compile(const void *ctx, const char *mainfn,
+                                         const unsigned char *tokenbuf,
+                                         const unsigned int bufsize,
+                                         const MOJOSHADER_swizzle *swiz,
+                                         const unsigned int swizcount,
+                                         const MOJOSHADER_samplerMap *smap,
+                                         const unsigned int smapcount)
+{
+    const MOJOSHADER_parseData *pd;
+    pd = MOJOSHADER_parse(MOJOSHADER_PROFILE_BYTECODE, mainfn, tokenbuf,
+                          bufsize, swiz, swizcount, smap, smapcount,
+                          NULL, NULL, NULL);
+    if (pd->error_count > 0)
+    {
+        MOJOSHADER_freeParseData(pd);
+        return NULL;
+    } // if
+    return (void *) pd;
+} // fake_compile
+
+static void MOJOSHADERCALL fake_addref(void *shader) {}
+
+static void MOJOSHADERCALL fake_delete(const void *ctx, void *shader)
+{
+    MOJOSHADER_freeParseData((const MOJOSHADER_parseData *) shader);
+} // fake_delete
+
+static MOJOSHADER_parseData *MOJOSHADERCALL fake_getparsedata(void *shader)
+{
+    return (MOJOSHADER_parseData *) shader;
+} // fake_getparsedata
+
+static void MOJOSHADERCALL fake_bind(const void *ctx, void *v, void *p)
+{
+    bound_vert = v;
+    bound_pixl = p;
+} // fake_bind
+
+static void MOJOSHADERCALL fake_getbound(const void *ctx, void **v, void **p)
+{
+    *v = bound_vert;
+    *p = bound_pixl;
+} // fake_getbound
+
+static void MOJOSHADERCALL fake_map(const void *ctx,
+                                    float **vsf, int **vsi, unsigned char **vsb,
+                                    float **psf, int **psi, unsigned char **psb)
+{
+    *vsf = vs_regs; *vsi = vs_regi; *vsb = vs_regb;
+    *psf = ps_regs; *psi = ps_regi; *psb = ps_regb;
+} // fake_map
+
+static void MOJOSHADERCALL fake_unmap(const void *ctx) {}
+
+static const char *MOJOSHADERCALL fake_geterror(const void *ctx)
+{
+    return "shader didn't compile";
+} // fake_geterror
+
+static int close_enough(const float a, const float b)
+{
+    // The effect runs in floats, MOJOSHADER_runPreshader() in doubles.
+    if (isnan(a) || isnan(b))
+        return isnan(a) && isnan(b);
+    else if (a == b)
+        return 1;  // including infinities.
+    return fabs((double) a - (double) b) <= (1e-4 * (fabs(a) + fabs(b) + 1.0));
+} // close_enough
+
+// Returns nonzero if (regs) holds what the shader's preshader computes.
+static int check_stage(const char *fname, void *shader, const float *regs,
+                       int *runs)
+{
+    static float expected[MAX_REGS * 4];
+    const MOJOSHADER_parseData *pd = (const MOJOSHADER_parseData *) shader;
+    int i;
+
+    if ((pd == NULL) || (pd->preshader == NULL))
+        return 1;
+
+    // CommitChanges left this run's inputs in the preshader's registers.
+    memcpy(expected, regs, sizeof (expected));
+    MOJOSHADER_runPreshader(pd->preshader, expected);
+    (*runs)++;
+
+    for (i = 0; i < MAX_REGS * 4; i++)
+    {
+        if (!close_enough(regs[i], expected[i]))
+        {
+            printf("%s: c%d.%c is %a, MOJOSHADER_runPreshader() says %a\n",
+                   fname, i / 4, "xyzw"[i % 4], regs[i], expected[i]);
+            return 0;
+        } // if
+    } // for
+    return 1;
+} // check_stage
+
+// Parameters read by shaders' constant preshaders get random values on
+//  every commit. Shader array selectors keep theirs, so they stay in range.
+static void randomize_inputs(MOJOSHADER_effect *effect)
+{
+    int i, j, k;
+    for (i = 0; i < effect->object_count; i++)
+    {
+        const MOJOSHADER_effectShader *shader = &effect->objects[i].shader;
+        const MOJOSHADER_parseData *pd;
+        if ((effect->objects[i].type != MOJOSHADER_SYMTYPE_VERTEXSHADER)
+         && (effect->objects[i].type != MOJOSHADER_SYMTYPE_PIXELSHADER))
+            continue;
+        else if ((shader->is_preshader) || (shader->shader == NULL))
+            continue;
+
+        pd = (const MOJOSHADER_parseData *) shader->shader;
+        if (pd->preshader == NULL)
+            continue;
+
+        for (j = 0; j < pd->preshader->symbol_count; j++)
+        {
+            const MOJOSHADER_effectParam *param;
+            float values[64];
+            param = MOJOSHADER_effectGetParameterByName(effect,
+                                        pd->preshader->symbols[j].name);
+            if ((param == NULL)
+             || (param->value.type.parameter_type != MOJOSHADER_SYMTYPE_FLOAT)
+             || (param->value.value_count > STATICARRAYLEN(values)))
+                continue;
+            for (k = 0; k < param->value.value_count; k++)
+                values[k] = (((float) (rng() & 0xFFFFFF) / 16777216.0f) - 0.5f) * 200.0f;
+            MOJOSHADER_effectSetRawValueHandle(param, values, 0,
+                                               param->value.value_count * 4);
+        } // for
+    } // for
+} // randomize_inputs
+
+static int check_effect(const char *fname, const unsigned char *buf,
+                        const unsigned int len, int *runs)
+{
+    MOJOSHADER_effectShaderContext ctx;
+    MOJOSHADER_effectStateChanges changes;
+    MOJOSHADER_effect *effect;
+    unsigned int passes, pass;
+    int retval = 1;
+    int i, j;
+
+    memset(&ctx, '\0', sizeof (ctx));
+    ctx.compileShader = fake_compile;
+    ctx.shaderAddRef = fake_addref;
+    ctx.deleteShader = fake_delete;
+    ctx.getParseData = fake_getparsedata;
+    ctx.bindShaders = fake_bind;
+    ctx.getBoundShaders = fake_getbound;
+    ctx.mapUniformBufferMemory = fake_map;
+    ctx.unmapUniformBufferMemory = fake_unmap;
+    ctx.getError = fake_geterror;
+
+    effect = MOJOSHADER_compileEffect(buf, len, NULL, 0, NULL, 0, &ctx);
+    if (effect->error_count > 0)
+    {
+        printf("%s: %s\n", fname, effect->errors[0].error);
+        MOJOSHADER_deleteEffect(effect);
+        return 0;
+    } // if
+
+    for (i = 0; retval && (i < effect->technique_count); i++)
+    {
+        MOJOSHADER_effectSetTechnique(effect, &effect->techniques[i]);
+        MOJOSHADER_effectBegin(effect, &passes, 0, &changes);
+        for (pass = 0; retval && (pass < passes); pass++)
+        {
+            MOJOSHADER_effectBeginPass(effect, pass);
+            for (j = 0; retval && (j < 100); j++)
+            {
+                randomize_inputs(effect);
+                MOJOSHADER_effectCommitChanges(effect);
+                retval = check_stage(fname, bound_vert, vs_regs, runs)
+                      && check_stage(fname, bound_pixl, ps_regs, runs);
+            } // for
+            MOJOSHADER_effectEndPass(effect);
+        } // for
+        MOJOSHADER_effectEnd(effect);
+    } // for
+
+    MOJOSHADER_deleteEffect(effect);
+    return retval;
+} // check_effect
+
+int main(int argc, char **argv)
+{
+    int retval = 0;
+    int runs = 0;
+    int i;
+
+#ifdef PRESHADER_SIMD
+    if (!check_ops(100000))
+        retval = 1;
+#else
+    printf("No four-wide preshader ops in this build, nothing to compare.\n");
+#endif
+
+    for (i = 1; i < argc; i++)
+    {
+        static unsigned char buf[1000000];
+        FILE *io = fopen(argv[i], "rb");
+        unsigned int len;
+        if (io == NULL)
+        {
+            printf(" ... fopen('%s') failed.\n", argv[i]);
+            retval = 1;
+            continue;
+        } // if
+        len = (unsigned int) fread(buf, 1, sizeof (buf), io);
+        fclose(io);
+        if (!check_effect(argv[i], buf, len, &runs))
+            retval = 1;
+    } // for
+
+    if (argc > 1)
+    {
+        printf("%d effect preshader runs checked against "
+               "MOJOSHADER_runPreshader(), %s.\n", runs,
+               retval ? "FAILED" : "all matched");
+    } // if
+
+    return retval;
+} // main
+
+// end of testpreshader.c ...
+
+